@@ -0,0 +1,237 @@
+//------------------------------------------------------------------
+// bench.cpp
+//------------------------------------------------------------------
+// Microbenchmarks de los núcleos: operaciones de conjuntos, métrica,
+// frentes de Pareto y operadores genéticos.
+//
+// Uso: bench [--filter <texto>] [--min_time <s>] [--csv]
+//
+// Parámetros: U = ancho del Bitset (U_size, fijo al compilar), activos
+// = elementos del universo que se usan (<= U_size), |F| y población. El
+// barrido de activos no cambia el coste de las operaciones de ancho
+// fijo; para barrer anchos reales, usar los bench_u<ancho> de la
+// escalera (-DTFG_ESCALERA=ON) o compilar con -DTFG_U_SIZE=...
+//------------------------------------------------------------------
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "domain.hpp"
+#include "generator.hpp"
+#include "genetico.hpp"
+#include "greedy.hpp"
+#include "incremental.hpp"
+#include "metrics.hpp"
+#include "solutions.hpp"
+
+using namespace std;
+
+//------------------------------------------------------------------
+// Contador de reservas de memoria (operator new global)
+//------------------------------------------------------------------
+static atomic<size_t> g_reservas{0};
+
+/* Sin inline: si GCC ve a la vez el new de la biblioteca y este delete,
+    avisa de free() sobre memoria de operator new (-Wmismatched-new-delete). */
+#if defined(__GNUC__)
+#define BENCH_SIN_INLINE __attribute__((noinline))
+#else
+#define BENCH_SIN_INLINE
+#endif
+
+BENCH_SIN_INLINE void* operator new(size_t n) {
+    g_reservas.fetch_add(1, memory_order_relaxed);
+    if (void* p = malloc(n ? n : 1)) return p;
+    throw bad_alloc();
+}
+BENCH_SIN_INLINE void operator delete(void* p) noexcept { free(p); }
+BENCH_SIN_INLINE void operator delete(void* p, size_t) noexcept { free(p); }
+
+//------------------------------------------------------------------
+// Medición
+//------------------------------------------------------------------
+struct Opciones {
+    string filtro;              // Solo benchmarks cuyo nombre contenga el filtro
+    double tiempo_min = 0.2;    // Tiempo mínimo de medición (s)
+    bool csv = false;           // Salida CSV
+};
+
+static volatile size_t g_sumidero = 0; // Evita que se eliminen los cálculos
+
+// Ejecuta fn() en lotes hasta superar el tiempo mínimo; imprime ns/op y reservas/op
+static void medir(const Opciones& opt, const string& nombre, const string& params,
+                  const function<void()>& fn) {
+    if (!opt.filtro.empty() && nombre.find(opt.filtro) == string::npos) return;
+
+    fn(); // calentamiento
+
+    size_t iters = 1, total = 0;
+    size_t reservas = 0;
+    double ns = 0.0;
+    while (true) {
+        size_t r0 = g_reservas.load(memory_order_relaxed);
+        auto t0 = chrono::steady_clock::now();
+        for (size_t i = 0; i < iters; i++) fn();
+        auto t1 = chrono::steady_clock::now();
+        reservas += g_reservas.load(memory_order_relaxed) - r0;
+        ns += chrono::duration<double, nano>(t1 - t0).count();
+        total += iters;
+        if (ns >= opt.tiempo_min * 1e9) break;
+        iters *= 2;
+    }
+
+    if (opt.csv) {
+        printf("%s,%s,%.1f,%.2f\n", nombre.c_str(), params.c_str(), ns / total, (double)reservas / total);
+    } else {
+        printf("%-28s %-34s %14.1f ns/op %10.2f allocs/op\n",
+               nombre.c_str(), params.c_str(), ns / total, (double)reservas / total);
+    }
+    fflush(stdout);
+}
+
+//------------------------------------------------------------------
+// Instancia de prueba
+//------------------------------------------------------------------
+struct Caso {
+    int n, nF, pop, k;
+    Bitset U, G;
+    vector<Bitset> F;
+    vector<SolMO> bloques_base;
+    vector<Individuo> poblacion;
+};
+
+static Caso crear_caso(int n, int nF, int pop, int k, int seed) {
+    Caso c{n, nF, pop, k, {}, {}, {}, {}, {}};
+    for (int i = 0; i < n; i++) c.U[i] = 1;
+    c.G = generar_G(n, n / 8, seed);
+    c.F = generar_F(n, nF, nF, max(1, n / 16), max(1, n / 2), seed);
+
+    for (size_t i = 0; i < c.F.size(); i++) {
+        Expression e(c.F[i], "F" + to_string(i), {(int)i}, 0);
+        c.bloques_base.emplace_back(e, 0, M(e, c.G, Metric::SizeH), M(e, c.G, Metric::Jaccard));
+    }
+    Expression e_u(c.U, "U", {-1}, 0);
+    c.bloques_base.emplace_back(e_u, 0, 1, M(e_u, c.G, Metric::Jaccard));
+
+    mt19937 rng(seed);
+    c.poblacion = inicializar_poblacion(c.F, c.U, c.G, k, pop, rng);
+    return c;
+}
+
+static string texto_params(const Caso& c, bool con_pop) {
+    string s = "U=" + to_string(U_size) + " activos=" + to_string(c.n) + " F=" + to_string(c.nF);
+    if (con_pop) s += " pop=" + to_string(c.pop);
+    return s;
+}
+
+//------------------------------------------------------------------
+// MAIN
+//------------------------------------------------------------------
+int main(int argc, char** argv) {
+    Opciones opt;
+    for (int i = 1; i < argc; i++) {
+        string a = argv[i];
+        if (a == "--filter") opt.filtro = argv[++i];
+        else if (a == "--min_time") opt.tiempo_min = stod(argv[++i]);
+        else if (a == "--csv") opt.csv = true;
+    }
+
+    if (opt.csv) printf("benchmark,params,ns_op,allocs_op\n");
+    else printf("U_size: %d\n", U_size);
+
+    const int k = 5;
+    vector<int> activos = {max(8, U_size / 4), max(8, U_size / 2), U_size};
+    vector<int> tam_F = {10, 50};
+    vector<int> tam_pob = {100, 200};
+
+    // Núcleos que dependen solo de los elementos activos y |F|
+    for (int n : activos) {
+        for (int nF : tam_F) {
+            Caso c = crear_caso(n, nF, 100, k, 1000 + n + nF);
+            string p = texto_params(c, false);
+            mt19937 rng(42);
+
+            size_t idx = 0;
+            medir(opt, "apply_op", p, [&] {
+                const Bitset& A = c.F[idx % c.F.size()];
+                const Bitset& B = c.F[(idx + 1) % c.F.size()];
+                g_sumidero += apply_op((int)(idx % 3), A, B).count();
+                idx++;
+            });
+
+            medir(opt, "M_jaccard", p, [&] {
+                g_sumidero += (size_t)(1000 * M(c.poblacion[idx % c.poblacion.size()].expr, c.G, Metric::Jaccard));
+                idx++;
+            });
+
+            vector<int> conjs;
+            for (int i = -1; i < min(nF, k); i++) conjs.push_back(i);
+            medir(opt, "build_random_expr", p, [&] {
+                g_sumidero += build_random_expr(conjs, c.F, c.U, k, rng).n_ops;
+            });
+
+            medir(opt, "crossover", p, [&] {
+                const Individuo& a = c.poblacion[idx % c.poblacion.size()];
+                const Individuo& b = c.poblacion[(idx * 7 + 3) % c.poblacion.size()];
+                g_sumidero += crossover(a, b, c.F, c.U, c.G, k, rng).n_ops;
+                idx++;
+            });
+
+            medir(opt, "mutar", p, [&] {
+                Individuo ind = c.poblacion[idx % c.poblacion.size()];
+                mutar(ind, c.F, c.U, c.G, k, rng, c.bloques_base);
+                g_sumidero += ind.n_ops;
+                idx++;
+            });
+
+            // Greedy completo frente a re-resolución tras modificar un conjunto
+            medir(opt, "greedy_completo", p, [&] {
+                g_sumidero += greedy_multiobjective_search(c.F, c.U, c.G, 3).size();
+            });
+
+            EstadoGreedy estado = greedy_estado_inicial(c.F, c.U, c.G, 3);
+            greedy_incremental(estado);
+            medir(opt, "greedy_incremental", p, [&] {
+                CambioF cambio;
+                cambio.tipo = CambioF::Modificar;
+                cambio.id = (int)(idx % c.F.size());
+                cambio.conjunto = c.F[(idx + 1) % c.F.size()];
+                aplicar_cambios(estado, {cambio});
+                g_sumidero += greedy_incremental(estado).size();
+                idx++;
+            });
+        }
+    }
+
+    // Núcleos que dependen del tamaño de población
+    for (int nF : tam_F) {
+        for (int pop : tam_pob) {
+            Caso c = crear_caso(U_size, nF, 2 * pop, k, 2000 + nF + pop);
+            string p = texto_params(c, true);
+            vector<Individuo> R = c.poblacion;
+
+            medir(opt, "pareto_front_generic", p, [&] {
+                g_sumidero += pareto_front_generic(R).size();
+            });
+
+            medir(opt, "fast_non_dominated_sort", p, [&] {
+                g_sumidero += fast_non_dominated_sort(R).size();
+            });
+
+            // Crowding sobre toda la población (peor caso: un único frente)
+            vector<Individuo> frente = R;
+            medir(opt, "calcular_crowding_distance", p, [&] {
+                calcular_crowding_distance(frente);
+                g_sumidero += (size_t)frente.size();
+            });
+        }
+    }
+    return 0;
+}
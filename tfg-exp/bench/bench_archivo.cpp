@@ -0,0 +1,193 @@
+//------------------------------------------------------------------
+// bench_archivo.cpp
+//------------------------------------------------------------------
+// Prueba de estrés y rendimiento del archivo concurrente
+// (archivo_concurrente.hpp): varios hilos insertan candidatas
+// sintéticas mientras otro lee, en modo frente y en modo élites, y el
+// resultado se compara con una referencia secuencial. Como línea base
+// se mide el mismo archivo por celdas protegido con un único mutex.
+//
+// Uso: bench_archivo [--hilos n] [--candidatas n] [--repeticiones n]
+//
+// Devuelve 1 si algún resultado difiere de la referencia. Para buscar
+// carreras, compilar con -DCMAKE_CXX_FLAGS=-fsanitize=thread.
+//------------------------------------------------------------------
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "archivo_concurrente.hpp"
+#include "solutions.hpp"
+
+using namespace std;
+
+//------------------------------------------------------------------
+// Candidatas y referencia secuencial
+//------------------------------------------------------------------
+static const int MAX_OPS = 5;
+static const int MAX_SIZEH = 6;
+
+// Objetivos discretos (muchos empates y muchas dominadas) y textos cortos
+static vector<Individuo> candidatas(size_t n, uint64_t seed) {
+    mt19937_64 rng(seed);
+    vector<Individuo> r(n);
+    for (auto& ind : r) {
+        ind.n_ops = (int)(rng() % (MAX_OPS + 1));
+        ind.sizeH = (int)(rng() % (MAX_SIZEH + 1));
+        ind.jaccard = (double)(rng() % 64) / 63.0;
+        ind.expr.n_ops = ind.n_ops;
+        ind.expr.expr_str = string(1 + rng() % 3, (char)('a' + rng() % 4));
+    }
+    return r;
+}
+
+// La preferida de cada celda, por n_ops y después |H|
+static vector<Individuo> referencia_elites(const vector<Individuo>& todas) {
+    vector<Individuo> celdas((MAX_OPS + 1) * (MAX_SIZEH + 1));
+    vector<bool> ocupada(celdas.size(), false);
+    for (const auto& ind : todas) {
+        const int c = ind.n_ops * (MAX_SIZEH + 1) + ind.sizeH;
+        if (!ocupada[c] || preferida_en_celda(ind, celdas[c])) celdas[c] = ind;
+        ocupada[c] = true;
+    }
+    vector<Individuo> r;
+    for (size_t c = 0; c < celdas.size(); c++) {
+        if (ocupada[c]) r.push_back(celdas[c]);
+    }
+    return r;
+}
+
+static bool mismas(const vector<Individuo>& a, const vector<Individuo>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i].n_ops != b[i].n_ops || a[i].sizeH != b[i].sizeH || a[i].jaccard != b[i].jaccard ||
+            a[i].expr.expr_str != b[i].expr.expr_str) return false;
+    }
+    return true;
+}
+
+static bool mismas(const vector<SolMO>& a, const vector<SolMO>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i].n_ops != b[i].n_ops || a[i].sizeH != b[i].sizeH || a[i].jaccard != b[i].jaccard ||
+            a[i].expr.expr_str != b[i].expr.expr_str) return false;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------
+// Línea base: celdas con un único mutex
+//------------------------------------------------------------------
+class ArchivoConMutex {
+public:
+    ArchivoConMutex() : celdas_((MAX_OPS + 1) * (MAX_SIZEH + 1)), ocupada_(celdas_.size(), false) {}
+
+    void insertar(const Individuo& ind) {
+        const int c = ind.n_ops * (MAX_SIZEH + 1) + ind.sizeH;
+        lock_guard<mutex> lk(m_);
+        if (!ocupada_[c] || preferida_en_celda(ind, celdas_[c])) celdas_[c] = ind;
+        ocupada_[c] = true;
+    }
+
+private:
+    mutex m_;
+    vector<Individuo> celdas_;
+    vector<bool> ocupada_;
+};
+
+//------------------------------------------------------------------
+// Ejecución concurrente
+//------------------------------------------------------------------
+// Reparte las candidatas entre 'hilos' (en bandas) y devuelve ns por inserción
+template <typename Insertar>
+static double insertar_en_paralelo(const vector<Individuo>& todas, int hilos, Insertar insertar) {
+    auto t0 = chrono::steady_clock::now();
+    vector<thread> trabajadores;
+    for (int h = 0; h < hilos; h++) {
+        trabajadores.emplace_back([&, h] {
+            for (size_t i = h; i < todas.size(); i += hilos) insertar(todas[i]);
+        });
+    }
+    for (auto& t : trabajadores) t.join();
+    auto t1 = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(t1 - t0).count() / todas.size();
+}
+
+//------------------------------------------------------------------
+// MAIN
+//------------------------------------------------------------------
+int main(int argc, char** argv) {
+    int hilos = (int)max(2u, thread::hardware_concurrency());
+    size_t num_candidatas = 200000;
+    int repeticiones = 20;
+    for (int i = 1; i < argc; i++) {
+        string a = argv[i];
+        if (a == "--hilos") hilos = stoi(argv[++i]);
+        else if (a == "--candidatas") num_candidatas = stoull(argv[++i]);
+        else if (a == "--repeticiones") repeticiones = stoi(argv[++i]);
+    }
+
+    int fallos = 0;
+    double ns_frente = 0.0, ns_elites = 0.0, ns_mutex = 0.0;
+    ArchivoConcurrente::Estadisticas st_frente;
+    for (int rep = 0; rep < repeticiones; rep++) {
+        const vector<Individuo> todas = candidatas(num_candidatas, 1000 + rep);
+        const vector<Individuo> ref_elites = referencia_elites(todas);
+        vector<SolMO> ref_frente;
+        for (const auto& ind : ref_elites) ref_frente.push_back(ind);
+        ref_frente = pareto_front(ref_frente);
+
+        // Modo frente, con un lector concurrente (las lecturas no bloquean)
+        {
+            ArchivoConcurrente A(MAX_OPS, MAX_SIZEH, true);
+            atomic<bool> fin{false};
+            thread lector([&] {
+                size_t leidas = 0;
+                while (!fin.load(memory_order_acquire)) leidas += A.frente().size() + A.num_ocupadas();
+                (void)leidas;
+            });
+            ns_frente += insertar_en_paralelo(todas, hilos, [&](const Individuo& ind) { A.insertar(ind); });
+            fin = true;
+            lector.join();
+            if (!mismas(A.frente(), ref_frente)) {
+                printf("Repetición %d: el frente difiere de la referencia\n", rep);
+                fallos++;
+            }
+            const auto s = A.estadisticas();
+            st_frente.candidatas += s.candidatas;
+            st_frente.rechazo_rapido += s.rechazo_rapido;
+            st_frente.rechazo_celda += s.rechazo_celda;
+            st_frente.insertadas += s.insertadas;
+            st_frente.reintentos += s.reintentos;
+        }
+
+        // Modo élites: todas las celdas deterministas
+        {
+            ArchivoConcurrente A(MAX_OPS, MAX_SIZEH, false);
+            ns_elites += insertar_en_paralelo(todas, hilos, [&](const Individuo& ind) { A.insertar(ind); });
+            if (!mismas(A.elites(), ref_elites)) {
+                printf("Repetición %d: las élites difieren de la referencia\n", rep);
+                fallos++;
+            }
+        }
+
+        ArchivoConMutex B;
+        ns_mutex += insertar_en_paralelo(todas, hilos, [&](const Individuo& ind) { B.insertar(ind); });
+    }
+
+    printf("Hilos: %d | Candidatas: %zu | Repeticiones: %d\n", hilos, num_candidatas, repeticiones);
+    printf("%-22s %10.1f ns/insercion\n", "concurrente (frente)", ns_frente / repeticiones);
+    printf("%-22s %10.1f ns/insercion\n", "concurrente (elites)", ns_elites / repeticiones);
+    printf("%-22s %10.1f ns/insercion\n", "mutex", ns_mutex / repeticiones);
+    printf("Frente: rechazo rapido %llu | rechazo celda %llu | insertadas %llu | reintentos %llu\n",
+           (unsigned long long)st_frente.rechazo_rapido, (unsigned long long)st_frente.rechazo_celda,
+           (unsigned long long)st_frente.insertadas, (unsigned long long)st_frente.reintentos);
+    printf("Fallos: %d\n", fallos);
+    return fallos == 0 ? 0 : 1;
+}
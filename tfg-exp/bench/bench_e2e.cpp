@@ -0,0 +1,302 @@
+//------------------------------------------------------------------
+// bench_e2e.cpp
+//------------------------------------------------------------------
+// Benchmark extremo a extremo calidad/tiempo: ejecuta exhaustiva,
+// greedy y NSGA-II sobre un corpus fijo de instancias (aleatorias y
+// ground truth) y compara con una línea base guardada en CSV.
+//
+// Uso: bench_e2e [--out <csv>] [--baseline <csv>] [--update_baseline]
+//                [--max_time_ratio r] [--max_rss_ratio r]
+//                [--max_eval_ratio r] [--hv_tol t] [--no_fork]
+//
+// Cada ejecución se hace en un proceso hijo para medir su pico de
+// memoria (ru_maxrss). Devuelve 1 si hay regresiones.
+//------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "domain.hpp"
+#include "exhaustiva.hpp"
+#include "generator.hpp"
+#include "genetico.hpp"
+#include "greedy.hpp"
+#include "ground_truth.hpp"
+#include "indicadores.hpp"
+#include "metrics.hpp"
+#include "solutions.hpp"
+
+#ifndef TFG_BENCH_DIR
+#define TFG_BENCH_DIR "bench"
+#endif
+
+using namespace std;
+
+//------------------------------------------------------------------
+// Corpus
+//------------------------------------------------------------------
+struct Caso {
+    string nombre;
+    vector<Bitset> F;
+    Bitset G;
+    int k = 3;
+    double jaccard_gold = -1.0; // < 0 si no hay expresión de referencia
+};
+
+static vector<Caso> crear_corpus(const Bitset& U) {
+    vector<Caso> corpus;
+    // Instancias aleatorias (semillas de small_config)
+    for (int seed : {1002, 1003, 1004}) {
+        Caso c;
+        c.nombre = "rand_s" + to_string(seed);
+        c.G = generar_G(U_size, 10, seed);
+        c.F = generar_F(U_size, 5, 8, 5, 40, seed);
+        corpus.push_back(move(c));
+    }
+    // Instancias ground truth
+    for (int seed : {1000, 1010, 1020}) {
+        auto gt = make_groundtruth(U, U_size, 5, 8, 5, 40, 3, seed);
+        Caso c;
+        c.nombre = "gt_s" + to_string(seed);
+        c.G = gt.G;
+        c.F = gt.F;
+        c.jaccard_gold = M(gt.gold_expr, gt.G, Metric::Jaccard);
+        corpus.push_back(move(c));
+    }
+    return corpus;
+}
+
+//------------------------------------------------------------------
+// Resultado de una ejecución (fila del CSV)
+//------------------------------------------------------------------
+struct Fila {
+    string instancia, algoritmo;
+    double tiempo_ms = 0.0;
+    long rss_kb = 0;
+    unsigned long long evaluaciones = 0;
+    double hipervolumen = 0.0;
+    int tam_frente = 0;
+    double mejor_jaccard = 0.0;
+    int hit_gold = -1;          // 1/0, -1 si la instancia no tiene gold
+};
+
+static const char* CABECERA_CSV =
+    "instancia,algoritmo,tiempo_ms,rss_kb,evaluaciones,hipervolumen,tam_frente,mejor_jaccard,hit_gold";
+
+static string fila_a_csv(const Fila& f) {
+    char buf[512];
+    snprintf(buf, sizeof(buf), "%s,%s,%.3f,%ld,%llu,%.9f,%d,%.9f,%d",
+             f.instancia.c_str(), f.algoritmo.c_str(), f.tiempo_ms, f.rss_kb,
+             f.evaluaciones, f.hipervolumen, f.tam_frente, f.mejor_jaccard, f.hit_gold);
+    return buf;
+}
+
+static bool csv_a_fila(const string& linea, Fila& f) {
+    stringstream ss(linea);
+    vector<string> c;
+    string tok;
+    while (getline(ss, tok, ',')) c.push_back(tok);
+    if (c.size() != 9 || c[0] == "instancia") return false;
+    f.instancia = c[0];
+    f.algoritmo = c[1];
+    f.tiempo_ms = stod(c[2]);
+    f.rss_kb = stol(c[3]);
+    f.evaluaciones = stoull(c[4]);
+    f.hipervolumen = stod(c[5]);
+    f.tam_frente = stoi(c[6]);
+    f.mejor_jaccard = stod(c[7]);
+    f.hit_gold = stoi(c[8]);
+    return true;
+}
+
+//------------------------------------------------------------------
+// Ejecución de un algoritmo sobre un caso
+//------------------------------------------------------------------
+template<typename T>
+static Fila medir_frente(const Caso& c, const string& algo, const function<vector<T>()>& ejecutar) {
+    reiniciar_evaluaciones();
+    auto t0 = chrono::steady_clock::now();
+    vector<T> frente = ejecutar();
+    auto t1 = chrono::steady_clock::now();
+
+    Fila f;
+    f.instancia = c.nombre;
+    f.algoritmo = algo;
+    f.tiempo_ms = chrono::duration<double, milli>(t1 - t0).count();
+    f.evaluaciones = evaluaciones_realizadas();
+    f.hipervolumen = hipervolumen(frente, c.k, (int)c.F.size());
+    f.tam_frente = (int)frente.size();
+    for (const auto& s : frente) f.mejor_jaccard = max(f.mejor_jaccard, s.jaccard);
+    if (c.jaccard_gold >= 0.0) f.hit_gold = (f.mejor_jaccard >= c.jaccard_gold) ? 1 : 0;
+
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    f.rss_kb = ru.ru_maxrss;
+    return f;
+}
+
+static Fila ejecutar_caso(const Caso& c, const string& algo, const Bitset& U) {
+    if (algo == "exhaustiva") {
+        return medir_frente<SolMO>(c, algo, [&] { return exhaustive_search(c.F, U, c.G, c.k); });
+    }
+    if (algo == "greedy") {
+        return medir_frente<SolMO>(c, algo, [&] { return greedy_multiobjective_search(c.F, U, c.G, c.k); });
+    }
+    // NSGA-II determinista: semilla fija y límite por generaciones
+    GAParams p;
+    p.population_size = 100;
+    p.max_generations = 100;
+    p.time_limit_sec = 3600;
+    p.crossover_prob = 0.8;
+    p.mutation_prob = 0.5;
+    p.tournament_size = 5;
+    p.seed = 12345;
+    return medir_frente<Individuo>(c, algo, [&] { return nsga2(c.F, U, c.G, c.k, p); });
+}
+
+// Ejecuta en un proceso hijo (pico de memoria aislado) y recoge la fila por una tubería
+static Fila ejecutar_aislado(const Caso& c, const string& algo, const Bitset& U, bool usar_fork) {
+    if (!usar_fork) return ejecutar_caso(c, algo, U);
+
+    int fd[2];
+    if (pipe(fd) != 0) return ejecutar_caso(c, algo, U);
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fd[0]);
+        string linea = fila_a_csv(ejecutar_caso(c, algo, U)) + "\n";
+        ssize_t escrito = write(fd[1], linea.data(), linea.size());
+        close(fd[1]);
+        _exit(escrito == (ssize_t)linea.size() ? 0 : 1);
+    }
+    close(fd[1]);
+    string salida;
+    char buf[512];
+    ssize_t n;
+    while ((n = read(fd[0], buf, sizeof(buf))) > 0) salida.append(buf, n);
+    close(fd[0]);
+    int estado = 0;
+    waitpid(pid, &estado, 0);
+
+    Fila f;
+    if (!csv_a_fila(salida.substr(0, salida.find('\n')), f)) {
+        throw runtime_error("Fallo en la ejecución de " + algo + " sobre " + c.nombre);
+    }
+    return f;
+}
+
+//------------------------------------------------------------------
+// Comparación con la línea base
+//------------------------------------------------------------------
+struct Umbrales {
+    double max_ratio_tiempo = 1.5;  // tiempo > ratio * base (+ 10 ms de holgura)
+    double max_ratio_rss = 1.5;     // memoria > ratio * base (+ 1 MB de holgura)
+    double max_ratio_eval = 1.10;   // evaluaciones > ratio * base
+    double tol_hv = 1e-9;           // hipervolumen < base - tol
+};
+
+static int comparar(const vector<Fila>& actual, const vector<Fila>& base, const Umbrales& u) {
+    map<pair<string, string>, Fila> idx;
+    for (const auto& f : base) idx[{f.instancia, f.algoritmo}] = f;
+
+    int regresiones = 0;
+    auto informar = [&](const Fila& f, const string& que, double a, double b) {
+        cout << "REGRESION " << f.instancia << " " << f.algoritmo << " " << que
+             << ": " << a << " (base " << b << ")\n";
+        regresiones++;
+    };
+
+    for (const auto& f : actual) {
+        auto it = idx.find({f.instancia, f.algoritmo});
+        if (it == idx.end()) {
+            cout << "SIN_BASE " << f.instancia << " " << f.algoritmo << "\n";
+            continue;
+        }
+        const Fila& b = it->second;
+        if (f.tiempo_ms > u.max_ratio_tiempo * b.tiempo_ms + 10.0) informar(f, "tiempo_ms", f.tiempo_ms, b.tiempo_ms);
+        if (f.rss_kb > u.max_ratio_rss * b.rss_kb + 1024) informar(f, "rss_kb", f.rss_kb, b.rss_kb);
+        if (f.evaluaciones > u.max_ratio_eval * b.evaluaciones) informar(f, "evaluaciones", f.evaluaciones, b.evaluaciones);
+        if (f.hipervolumen < b.hipervolumen - u.tol_hv) informar(f, "hipervolumen", f.hipervolumen, b.hipervolumen);
+        if (b.hit_gold == 1 && f.hit_gold != 1) informar(f, "hit_gold", f.hit_gold, b.hit_gold);
+    }
+    return regresiones;
+}
+
+static vector<Fila> leer_csv(const string& path) {
+    vector<Fila> filas;
+    ifstream in(path);
+    string linea;
+    Fila f;
+    while (getline(in, linea)) {
+        if (csv_a_fila(linea, f)) filas.push_back(f);
+    }
+    return filas;
+}
+
+static void escribir_csv(const string& path, const vector<Fila>& filas) {
+    ofstream out(path);
+    out << CABECERA_CSV << "\n";
+    for (const auto& f : filas) out << fila_a_csv(f) << "\n";
+}
+
+//------------------------------------------------------------------
+// MAIN
+//------------------------------------------------------------------
+int main(int argc, char** argv) {
+    string salida_path;
+    string base_path = string(TFG_BENCH_DIR) + "/baseline_e2e.csv";
+    bool actualizar = false, usar_fork = true;
+    Umbrales u;
+
+    for (int i = 1; i < argc; i++) {
+        string a = argv[i];
+        if (a == "--out") salida_path = argv[++i];
+        else if (a == "--baseline") base_path = argv[++i];
+        else if (a == "--update_baseline") actualizar = true;
+        else if (a == "--max_time_ratio") u.max_ratio_tiempo = stod(argv[++i]);
+        else if (a == "--max_rss_ratio") u.max_ratio_rss = stod(argv[++i]);
+        else if (a == "--max_eval_ratio") u.max_ratio_eval = stod(argv[++i]);
+        else if (a == "--hv_tol") u.tol_hv = stod(argv[++i]);
+        else if (a == "--no_fork") usar_fork = false;
+    }
+
+    Bitset U;
+    U.set();
+    vector<Caso> corpus = crear_corpus(U);
+
+    vector<Fila> filas;
+    cout << CABECERA_CSV << "\n";
+    for (const auto& c : corpus) {
+        for (const string algo : {"exhaustiva", "greedy", "nsga2"}) {
+            filas.push_back(ejecutar_aislado(c, algo, U, usar_fork));
+            cout << fila_a_csv(filas.back()) << endl;
+        }
+    }
+
+    if (!salida_path.empty()) escribir_csv(salida_path, filas);
+
+    if (actualizar) {
+        escribir_csv(base_path, filas);
+        cout << "Línea base actualizada: " << base_path << "\n";
+        return 0;
+    }
+
+    vector<Fila> base = leer_csv(base_path);
+    if (base.empty()) {
+        cout << "Sin línea base en " << base_path << " (usar --update_baseline)\n";
+        return 0;
+    }
+    int r = comparar(filas, base, u);
+    cout << (r == 0 ? "SIN_REGRESIONES" : "REGRESIONES: " + to_string(r)) << "\n";
+    return r == 0 ? 0 : 1;
+}
@@ -0,0 +1,66 @@
+"""Comprueba que todos los ejecutables de la escalera de anchos
+(main_u<ancho> y main_comprimido) dan el mismo frente para la misma
+instancia. Se genera una instancia que cabe en el ancho más pequeño y se
+compara la salida JSON de cada algoritmo sin tiempos ni u_size.
+
+Uso: python3 comprobar_escalera.py <directorio_de_compilacion>
+"""
+import json
+import subprocess
+import sys
+import tempfile
+from pathlib import Path
+
+# (universo, |F|, |G| máx., semilla) de las instancias de prueba
+INSTANCIAS = [(50, 6, 20, 5), (60, 8, 30, 11)]
+ALGORITMOS = [("exhaustiva", 2), ("greedy", 3), ("mitm", 2)]
+
+
+def ejecutables(directorio):
+    """main_u<ancho> de menor a mayor y después main_comprimido"""
+    anchos = sorted((p for p in directorio.glob("main_u*") if p.name[6:].isdigit()),
+                    key=lambda p: int(p.name[6:]))
+    comprimido = directorio / "main_comprimido"
+    return anchos + ([comprimido] if comprimido.exists() else [])
+
+
+def frentes(exe, instancia, algo, k):
+    """Frentes de la salida JSON sin los campos que dependen del ancho"""
+    r = subprocess.run([str(exe), "--instance", str(instancia), "--algo", algo, "--k", str(k),
+                        "--quiet", "--output", "json"], capture_output=True, text=True, check=True)
+    datos = json.loads(r.stdout)
+    for f in datos["frentes"]:
+        f.pop("tiempo_ms", None)
+    return datos["instancia"], datos["frentes"]
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(__doc__)
+        sys.exit(2)
+    exes = ejecutables(Path(sys.argv[1]))
+    if len(exes) < 2:
+        print("Error: hacen falta al menos dos ejecutables de la escalera")
+        sys.exit(2)
+
+    fallos = 0
+    with tempfile.TemporaryDirectory() as tmp:
+        for universo, num_F, G_max, seed in INSTANCIAS:
+            instancia = Path(tmp) / f"u{universo}_s{seed}.bin"
+            subprocess.run([str(exes[0]), "--gen_instance", str(instancia), "--gen_n", str(universo),
+                            "--gen_F", str(num_F), "--gen_Gmax", str(G_max), "--seed", str(seed)],
+                           capture_output=True, check=True)
+            for algo, k in ALGORITMOS:
+                referencia = frentes(exes[0], instancia, algo, k)
+                for exe in exes[1:]:
+                    if frentes(exe, instancia, algo, k) != referencia:
+                        print(f"✗ {exe.name} difiere de {exes[0].name}: universo {universo}, "
+                              f"semilla {seed}, {algo} k={k}")
+                        fallos += 1
+    print(f"Ejecutables: {', '.join(e.name for e in exes)}")
+    print(f"Fallos: {fallos}")
+    sys.exit(1 if fallos else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -80,7 +80,29 @@ def compilar_programa(u_size):
         src_dir / 'greedy.cpp',
         src_dir / 'genetico.cpp',
         src_dir / 'generator.cpp',
-        src_dir / 'ground_truth.cpp'
+        src_dir / 'ground_truth.cpp',
+        src_dir / 'batch.cpp',
+        src_dir / 'instance_io.cpp',
+        src_dir / 'pool.cpp',
+        src_dir / 'runner.cpp',
+        src_dir / 'salida.cpp',
+        src_dir / 'atomos.cpp',
+        src_dir / 'servidor.cpp',
+        src_dir / 'tfgcore_c.cpp',
+        src_dir / 'incremental.cpp',
+        src_dir / 'cache.cpp',
+        src_dir / 'hibrido.cpp',
+        src_dir / 'arbol.cpp',
+        src_dir / 'memetica.cpp',
+        src_dir / 'simplificacion.cpp',
+        src_dir / 'mapelites.cpp',
+        src_dir / 'consulta.cpp',
+        src_dir / 'sat.cpp',
+        src_dir / 'decision_sat.cpp',
+        src_dir / 'encuentro.cpp',
+        src_dir / 'muestreo.cpp',
+        src_dir / 'comprimido.cpp',
+        src_dir / 'archivo_concurrente.cpp'
     ]
     
     # Verificar que existen los archivos
@@ -95,6 +117,7 @@ def compilar_programa(u_size):
         f'-DU_SIZE={u_size}',
         '-std=c++17',
         '-O3',
+        '-pthread',
         f'-I{include_dir}',
         '-o', str(build_dir / 'main')
     ] + [str(s) for s in sources]
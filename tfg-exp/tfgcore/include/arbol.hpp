@@ -0,0 +1,54 @@
+//----------------------------------------------------------------------
+// arbol.hpp
+//----------------------------------------------------------------------
+// Árbol de una expresión, reconstruido a partir de expr_str.
+//----------------------------------------------------------------------
+//
+// Gramática de expr_str (la que generan todos los algoritmos):
+//   nodo := "(" nodo " ∪ " nodo ")" | "(" nodo " ∩ " nodo ")"
+//         | "(" nodo " \ " nodo ")" | "F" <índice> | "U" | "∅"
+//
+// Cada nodo guarda el conjunto de su subárbol, así que cambiar una hoja
+// o una operación solo obliga a recalcular el camino hasta la raíz.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "domain.hpp"
+#include "expr.hpp"
+
+// Hojas que no son un F_i
+constexpr int HOJA_U = -1;      // Universo (índice -1 en used_sets)
+constexpr int HOJA_VACIA = -2;  // Conjunto vacío (no cuenta en used_sets)
+
+//------------------------------------------------------------------
+// Nodo del árbol
+//------------------------------------------------------------------
+struct NodoExpr {
+    int op = -1;            // 0 = ∪, 1 = ∩, 2 = \ ; -1 = hoja
+    int hoja = HOJA_VACIA;  // Hojas: índice en F, HOJA_U o HOJA_VACIA
+    int izq = -1;           // Hijos (nodos internos)
+    int der = -1;
+    int padre = -1;         // -1 en la raíz
+    Bitset conjunto;        // Valor del subárbol
+};
+
+struct ArbolExpr {
+    std::vector<NodoExpr> nodos;
+    int raiz = -1;
+};
+
+// Construye el árbol de expr_str; lanza invalid_argument si no sigue la gramática
+ArbolExpr parsear_expresion(const std::string& expr_str, const std::vector<Bitset>& F, const Bitset& U);
+
+// Recalcula los conjuntos desde 'nodo' (incluido) hasta la raíz
+void recalcular_camino(ArbolExpr& arbol, int nodo);
+
+// Texto del subárbol de 'nodo' (raíz si nodo < 0), con el formato de expr_str
+std::string arbol_texto(const ArbolExpr& arbol, int nodo = -1);
+
+// Expresión completa: conjunto, texto, used_sets (U = -1) y n_ops
+Expression arbol_a_expresion(const ArbolExpr& arbol);
@@ -0,0 +1,99 @@
+//----------------------------------------------------------------------
+// archivo_concurrente.hpp
+//----------------------------------------------------------------------
+// Archivo de soluciones compartido entre hilos, sin cerrojos, con una
+// celda por (n_ops, |H|).
+//----------------------------------------------------------------------
+//
+// Como n_ops y |H| son enteros acotados, en cada celda solo puede ser
+// no dominada la solución de mayor Jaccard. Cada celda es un puntero
+// atómico a una entrada inmutable. insertar() la sustituye con CAS si
+// la candidata es preferible: mayor Jaccard y, en empate, la expresión
+// más corta y después la menor. Es el mismo orden que ArchivoElites, así
+// que el contenido final no depende del orden ni del reparto entre
+// hilos.
+//
+// Modo frente (solo_no_dominadas): antes de reservar memoria se leen las
+// celdas (n_ops' <= n_ops, |H|' <= |H|). Si alguna domina a la candidata
+// se descarta sin escribir nada; es el caso habitual. Las celdas que
+// queden dominadas más tarde se filtran al extraer. Se guarda una sola
+// solución por vector de objetivos: la preferida. frente() es
+// determinista; elites() solo lo es en modo élites (sin rechazo), porque
+// una celda dominada puede quedarse con una u otra candidata según el
+// orden de llegada.
+//
+// Lectores (estilo RCU): leen los punteros sin bloquear y la entrada
+// sigue siendo válida aunque se sustituya. Las entradas sustituidas se
+// liberan en recoger(), que debe llamarse sin operaciones en curso (por
+// ejemplo, al terminar un lote), o al destruir el archivo.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "solutions.hpp"
+
+// true si a es preferible a b en la misma celda (orden total)
+inline bool preferida_en_celda(const SolMO& a, const SolMO& b) {
+    if (a.jaccard != b.jaccard) return a.jaccard > b.jaccard;
+    if (a.expr.expr_str.size() != b.expr.expr_str.size()) return a.expr.expr_str.size() < b.expr.expr_str.size();
+    return a.expr.expr_str < b.expr.expr_str;
+}
+
+class ArchivoConcurrente {
+public:
+    struct Estadisticas {
+        std::uint64_t candidatas = 0;       // Llamadas a insertar
+        std::uint64_t rechazo_rapido = 0;   // Dominadas por otra celda (sin reservar)
+        std::uint64_t rechazo_celda = 0;    // Peores que la entrada de su celda
+        std::uint64_t insertadas = 0;       // Publicadas (celda nueva o sustitución)
+        std::uint64_t reintentos = 0;       // CAS fallidos por otro hilo
+    };
+
+    ArchivoConcurrente(int max_ops, int max_sizeH, bool solo_no_dominadas = true);
+    ~ArchivoConcurrente();
+    ArchivoConcurrente(const ArchivoConcurrente&) = delete;
+    ArchivoConcurrente& operator=(const ArchivoConcurrente&) = delete;
+
+    int max_ops() const { return max_ops_; }
+    int max_sizeH() const { return max_sizeH_; }
+    int num_celdas() const { return num_celdas_; }
+    int celda(int n_ops, int sizeH) const { return n_ops * (max_sizeH_ + 1) + sizeH; }
+
+    // Seguro entre hilos; devuelve true si la candidata queda publicada
+    bool insertar(const Individuo& ind);
+
+    // Lecturas sin bloqueo (instantánea de cada celda al leerla)
+    bool leer(int celda, Individuo& out) const;
+    std::vector<Individuo> elites() const;      // Celdas ocupadas, por n_ops y después |H|
+    std::vector<SolMO> frente() const;          // No dominadas, ordenadas como pareto_front
+    int num_ocupadas() const;
+    Estadisticas estadisticas() const;
+
+    // Libera las entradas sustituidas (sin operaciones concurrentes)
+    void recoger();
+
+private:
+    struct Entrada {
+        Individuo ind;
+        Entrada* siguiente_retirada = nullptr;
+    };
+
+    int max_ops_ = 0;
+    int max_sizeH_ = 0;
+    bool solo_no_dominadas_ = true;
+    int num_celdas_ = 0;
+    std::unique_ptr<std::atomic<Entrada*>[]> celdas_;
+    std::atomic<Entrada*> retiradas_{nullptr};
+
+    std::atomic<std::uint64_t> candidatas_{0}, rechazo_rapido_{0}, rechazo_celda_{0},
+        insertadas_{0}, reintentos_{0};
+
+    bool dominada_por_otra(const Individuo& ind) const;
+    void retirar(Entrada* e);
+};
@@ -0,0 +1,31 @@
+//----------------------------------------------------------------------
+// atomos.hpp
+//----------------------------------------------------------------------
+// Átomos de una familia F: clases de elementos de U que pertenecen
+// exactamente a los mismos F_i. Cualquier expresión sobre F y U es
+// una unión de átomos, así que los átomos acotan lo alcanzable.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "domain.hpp"
+
+//------------------------------------------------------------------
+// Tabla de átomos (independiente de G)
+//------------------------------------------------------------------
+struct TablaAtomos {
+    std::vector<int> atomo;     // atomo[i]: átomo del elemento i (-1 si i no está en U)
+    std::vector<int> tam;       // tam[a]: número de elementos del átomo a
+};
+
+TablaAtomos construir_atomos(const std::vector<Bitset>& F, const Bitset& U);
+
+//------------------------------------------------------------------
+/* Cota superior exacta del Jaccard alcanzable por cualquier unión de
+    átomos (y, por tanto, por cualquier expresión, sin límite de k).
+    El óptimo de I / (|G| + S - I) es un prefijo de los átomos
+    ordenados por |A ∩ G| / |A| descendente. */
+//------------------------------------------------------------------
+double cota_jaccard(const TablaAtomos& t, const Bitset& G);
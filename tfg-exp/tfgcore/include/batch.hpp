@@ -0,0 +1,57 @@
+//----------------------------------------------------------------------
+// batch.hpp
+//----------------------------------------------------------------------
+// Resolución por lotes: una familia F y muchos conjuntos objetivo G.
+// Las combinaciones de conjuntos se calculan una sola vez y se evalúan
+// contra todos los objetivos.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "expr.hpp"
+#include "domain.hpp"
+#include "niveles.hpp"
+#include "solutions.hpp"
+
+//------------------------------------------------------------------
+/* Tabla de candidatos: todas las expresiones hasta k operaciones, por
+    niveles en estructura de arrays (conjunto y máscara de conjuntos
+    usados). Las cadenas solo se construyen para los frentes. */
+//------------------------------------------------------------------
+struct TablaCandidatos {
+    int k = 0;                                      // Profundidad máxima
+    int num_conjuntos = 0;                          // |F|
+    std::vector<NivelSoA> niveles;                  // niveles[s]: expresiones con s operaciones
+    std::vector<std::vector<BloqueNivel>> bloques;  // bloques[s]: tramos (op, a, b) del nivel s
+};
+
+//------------------------------------------------------------------
+// Construcción de la tabla (independiente de G)
+//------------------------------------------------------------------
+TablaCandidatos construir_tabla_candidatos(
+    const std::vector<Bitset>& F,
+    const Bitset& U,
+    int k);
+
+// Memoria aproximada de construir_tabla_candidatos (sizeof(Bitset) por conjunto; satura en UINT64_MAX)
+std::uint64_t bytes_tabla_candidatos(std::size_t num_F, int k);
+
+//------------------------------------------------------------------
+/* Evalúa la tabla contra todos los objetivos y devuelve un frente de
+    Pareto por objetivo (mismo orden que Gs). */
+//------------------------------------------------------------------
+std::vector<std::vector<SolMO>> evaluar_objetivos(
+    const TablaCandidatos& tabla,
+    const std::vector<Bitset>& Gs);
+
+//------------------------------------------------------------------
+// Búsqueda exhaustiva por lotes (tabla + evaluación)
+//------------------------------------------------------------------
+std::vector<std::vector<SolMO>> batch_exhaustive_search(
+    const std::vector<Bitset>& F,
+    const Bitset& U,
+    const std::vector<Bitset>& Gs,
+    int k);
@@ -0,0 +1,77 @@
+//----------------------------------------------------------------------
+// cache.hpp
+//----------------------------------------------------------------------
+// Caché persistente de soluciones: la huella de (U, G, F, algoritmo,
+// k, parámetros) indexa el frente de Pareto guardado en disco junto
+// con el tiempo de la ejecución original.
+//----------------------------------------------------------------------
+//
+// Una entrada por fichero: <dir>/<huella en hex>.frente
+//   "TFGCACH1", u64 huella, u64 universo, i64 tiempo_ms, u32 n, y por
+//   solución i32 n_ops, i32 sizeH, f64 jaccard, u32 len + expr_str,
+//   u32 num_usados + i32 usados[], conjunto en u64 (universo / 64)
+//
+// Seguro con varios procesos: cada entrada se escribe en un temporal
+// y se publica con rename (atómico), así un lector ve la entrada
+// completa o ninguna. Las entradas ilegibles cuentan como fallo.
+// Al superar max_bytes se borran las menos usadas (mtime; cada
+// acierto actualiza el mtime de su entrada).
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "domain.hpp"
+#include "genetico.hpp"
+#include "solutions.hpp"
+
+struct CacheSoluciones {
+    std::string dir;                            // Directorio de la caché
+    std::uint64_t max_bytes = 1024ull << 20;    // Tamaño máximo (1 GB)
+    std::uint64_t universo = U_size;            // Universo de la instancia (palabras por conjunto)
+};
+
+struct EntradaCache {
+    std::vector<SolMO> frente;
+    long long tiempo_ms = 0;    // Tiempo de la ejecución que produjo el frente
+};
+
+//------------------------------------------------------------------
+/* Huella (FNV-1a de 64 bits) de la instancia empaquetada y de los
+    parámetros. 'ga' solo se usa para el genético. */
+//------------------------------------------------------------------
+std::uint64_t clave_cache(const std::vector<Bitset>& F, const Bitset& U, const Bitset& G,
+                          const std::string& algoritmo, int k, const GAParams* ga = nullptr);
+
+bool cache_buscar(const CacheSoluciones& cache, std::uint64_t clave, EntradaCache& out);
+void cache_guardar(const CacheSoluciones& cache, std::uint64_t clave, const EntradaCache& entrada);
+
+//------------------------------------------------------------------
+/* Consulta la caché antes de resolver: en un acierto devuelve el frente
+    guardado y su tiempo original; si no, resuelve, mide y guarda.
+    cache == nullptr desactiva la caché. */
+//------------------------------------------------------------------
+template<typename T, typename Fn>
+std::vector<T> resolver_con_cache(const CacheSoluciones* cache, std::uint64_t clave,
+                                  long long& tiempo_ms, bool& acierto, Fn&& resolver) {
+    acierto = false;
+    EntradaCache e;
+    if (cache && cache_buscar(*cache, clave, e)) {
+        acierto = true;
+        tiempo_ms = e.tiempo_ms;
+        return std::vector<T>(e.frente.begin(), e.frente.end());
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<T> r = resolver();
+    tiempo_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - t0).count();
+    if (cache) {
+        e.frente.assign(r.begin(), r.end());
+        e.tiempo_ms = tiempo_ms;
+        cache_guardar(*cache, clave, e);
+    }
+    return r;
+}
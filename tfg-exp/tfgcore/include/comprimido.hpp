@@ -0,0 +1,255 @@
+//----------------------------------------------------------------------
+// comprimido.hpp
+//----------------------------------------------------------------------
+// Conjunto comprimido al estilo Roaring para universos grandes y
+// conjuntos dispersos, con la misma interfaz que std::bitset<N> que usa
+// el resto del código (operadores, count, none, [], set, reset, ==,
+// std::hash).
+//----------------------------------------------------------------------
+//
+// El universo se parte en bloques de 2^16 elementos (clave = 16 bits
+// altos). Solo se guardan los bloques no vacíos, ordenados por clave,
+// y cada uno en el contenedor más pequeño para su contenido:
+//   Array   elementos ordenados (uint16)           2 bytes por elemento
+//   Mapa    1024 palabras de 64 bits               8 KiB fijos
+//   Rachas  pares (inicio, longitud - 1) (uint16)  4 bytes por racha
+// Las operaciones recorren solo los bloques presentes, así que escalan
+// con la cardinalidad y no con N. El complemento rellena los bloques
+// ausentes con una racha completa (U, U \ G, ... ocupan pocos bytes).
+//
+// set/reset no recompactan el bloque a rachas (sería recorrerlo en cada
+// llamada); las operaciones binarias sí eligen el contenedor mínimo.
+// Por eso == y el hash comparan contenido y no representación.
+//
+// Se activa con la opción de CMake TFG_CONJUNTO_COMPRIMIDO, que cambia
+// el tipo Bitset de domain.hpp.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+//------------------------------------------------------------------
+// Contenedor de un bloque de 2^16 elementos
+//------------------------------------------------------------------
+constexpr std::uint32_t BLOQUE_ROARING = 1u << 16;
+
+struct ContenedorRoaring {
+    enum Tipo : std::uint8_t { Array, Mapa, Rachas };
+
+    std::uint16_t clave = 0;
+    Tipo tipo = Array;
+    std::uint32_t card = 0;
+    std::vector<std::uint16_t> valores;    // Array: elementos; Rachas: (inicio, longitud - 1)
+    std::vector<std::uint64_t> mapa;       // Mapa: 1024 palabras
+};
+
+// Operaciones sobre contenedores de la misma clave (comprimido.cpp)
+enum class OpRoaring { Union, Interseccion, Diferencia, DifSimetrica };
+
+bool roaring_contiene(const ContenedorRoaring& c, std::uint16_t x);
+void roaring_insertar(ContenedorRoaring& c, std::uint16_t x);
+void roaring_borrar(ContenedorRoaring& c, std::uint16_t x);
+ContenedorRoaring roaring_op(OpRoaring op, const ContenedorRoaring& a, const ContenedorRoaring& b);
+// Complemento dentro de [0, limite)
+ContenedorRoaring roaring_complemento(const ContenedorRoaring& c, std::uint32_t limite);
+ContenedorRoaring roaring_lleno(std::uint16_t clave, std::uint32_t limite);
+bool roaring_iguales(const ContenedorRoaring& a, const ContenedorRoaring& b);
+std::size_t roaring_hash(const ContenedorRoaring& c);
+// Primer elemento >= desde (-1 si no hay)
+long roaring_siguiente(const ContenedorRoaring& c, std::uint32_t desde);
+std::size_t roaring_memoria(const ContenedorRoaring& c);
+
+//------------------------------------------------------------------
+// Conjunto comprimido sobre [0, N)
+//------------------------------------------------------------------
+template <std::size_t N>
+class ConjuntoComprimido {
+public:
+    // Referencia a un elemento (como std::bitset::reference)
+    class reference {
+    public:
+        reference(ConjuntoComprimido& c, std::size_t i) : c_(c), i_(i) {}
+        operator bool() const { return c_.test(i_); }
+        bool operator~() const { return !c_.test(i_); }
+        reference& operator=(bool v) {
+            c_.set(i_, v);
+            return *this;
+        }
+        reference& operator=(const reference& o) { return *this = static_cast<bool>(o); }
+    private:
+        ConjuntoComprimido& c_;
+        std::size_t i_;
+    };
+
+    constexpr std::size_t size() const { return N; }
+    bool none() const { return bloques_.empty(); }
+    bool any() const { return !bloques_.empty(); }
+    bool all() const { return count() == N; }
+
+    std::size_t count() const {
+        std::size_t n = 0;
+        for (const auto& b : bloques_) n += b.card;
+        return n;
+    }
+
+    bool test(std::size_t i) const {
+        const ContenedorRoaring* b = buscar(clave(i));
+        return b && roaring_contiene(*b, bajo(i));
+    }
+    bool operator[](std::size_t i) const { return test(i); }
+    reference operator[](std::size_t i) { return reference(*this, i); }
+
+    ConjuntoComprimido& set() {
+        bloques_.clear();
+        for (std::size_t k = 0; k < num_bloques(); k++) bloques_.push_back(roaring_lleno((std::uint16_t)k, limite(k)));
+        return *this;
+    }
+    ConjuntoComprimido& set(std::size_t i, bool v = true) {
+        if (!v) return reset(i);
+        roaring_insertar(obtener(clave(i)), bajo(i));
+        return *this;
+    }
+    ConjuntoComprimido& reset() {
+        bloques_.clear();
+        return *this;
+    }
+    ConjuntoComprimido& reset(std::size_t i) {
+        const auto it = posicion(clave(i));
+        if (it == bloques_.end() || it->clave != clave(i)) return *this;
+        roaring_borrar(*it, bajo(i));
+        if (it->card == 0) bloques_.erase(it);
+        return *this;
+    }
+
+    // Primer elemento >= i (N si no hay), para recorrer sin probar los N
+    std::size_t siguiente(std::size_t i) const {
+        for (auto it = posicion(clave(i)); it != bloques_.end(); ++it) {
+            const std::uint32_t desde = it->clave == clave(i) ? bajo(i) : 0;
+            const long x = roaring_siguiente(*it, desde);
+            if (x >= 0) return (std::size_t)it->clave * BLOQUE_ROARING + (std::size_t)x;
+        }
+        return N;
+    }
+
+    // Bytes ocupados por los contenedores
+    std::size_t memoria() const {
+        std::size_t m = bloques_.capacity() * sizeof(ContenedorRoaring);
+        for (const auto& b : bloques_) m += roaring_memoria(b);
+        return m;
+    }
+
+    ConjuntoComprimido operator~() const {
+        ConjuntoComprimido r;
+        auto it = bloques_.begin();
+        for (std::size_t k = 0; k < num_bloques(); k++) {
+            if (it != bloques_.end() && it->clave == k) {
+                ContenedorRoaring c = roaring_complemento(*it++, limite(k));
+                if (c.card) r.bloques_.push_back(std::move(c));
+            } else {
+                r.bloques_.push_back(roaring_lleno((std::uint16_t)k, limite(k)));
+            }
+        }
+        return r;
+    }
+
+    ConjuntoComprimido& operator|=(const ConjuntoComprimido& o) { return *this = combinar(OpRoaring::Union, *this, o); }
+    ConjuntoComprimido& operator&=(const ConjuntoComprimido& o) { return *this = combinar(OpRoaring::Interseccion, *this, o); }
+    ConjuntoComprimido& operator^=(const ConjuntoComprimido& o) { return *this = combinar(OpRoaring::DifSimetrica, *this, o); }
+
+    friend ConjuntoComprimido operator|(const ConjuntoComprimido& a, const ConjuntoComprimido& b) {
+        return combinar(OpRoaring::Union, a, b);
+    }
+    friend ConjuntoComprimido operator&(const ConjuntoComprimido& a, const ConjuntoComprimido& b) {
+        return combinar(OpRoaring::Interseccion, a, b);
+    }
+    friend ConjuntoComprimido operator^(const ConjuntoComprimido& a, const ConjuntoComprimido& b) {
+        return combinar(OpRoaring::DifSimetrica, a, b);
+    }
+    // A \ B sin materializar ~B
+    friend ConjuntoComprimido diferencia(const ConjuntoComprimido& a, const ConjuntoComprimido& b) {
+        return combinar(OpRoaring::Diferencia, a, b);
+    }
+
+    bool operator==(const ConjuntoComprimido& o) const {
+        if (bloques_.size() != o.bloques_.size()) return false;
+        for (std::size_t i = 0; i < bloques_.size(); i++) {
+            if (!roaring_iguales(bloques_[i], o.bloques_[i])) return false;
+        }
+        return true;
+    }
+    bool operator!=(const ConjuntoComprimido& o) const { return !(*this == o); }
+
+    std::size_t hash() const {
+        std::size_t h = 0;
+        for (const auto& b : bloques_) h = h * 1000003u ^ roaring_hash(b);
+        return h;
+    }
+
+private:
+    std::vector<ContenedorRoaring> bloques_;    // No vacíos, ordenados por clave
+
+    static constexpr std::size_t num_bloques() { return (N + BLOQUE_ROARING - 1) / BLOQUE_ROARING; }
+    static std::uint32_t limite(std::size_t k) {
+        return (k + 1) * BLOQUE_ROARING <= N ? BLOQUE_ROARING : (std::uint32_t)(N - k * BLOQUE_ROARING);
+    }
+    static std::uint16_t clave(std::size_t i) { return (std::uint16_t)(i >> 16); }
+    static std::uint16_t bajo(std::size_t i) { return (std::uint16_t)(i & 0xFFFF); }
+
+    typename std::vector<ContenedorRoaring>::iterator posicion(std::uint16_t k) {
+        std::size_t lo = 0, hi = bloques_.size();
+        while (lo < hi) {
+            const std::size_t m = (lo + hi) / 2;
+            if (bloques_[m].clave < k) lo = m + 1; else hi = m;
+        }
+        return bloques_.begin() + lo;
+    }
+    typename std::vector<ContenedorRoaring>::const_iterator posicion(std::uint16_t k) const {
+        return const_cast<ConjuntoComprimido*>(this)->posicion(k);
+    }
+    const ContenedorRoaring* buscar(std::uint16_t k) const {
+        const auto it = posicion(k);
+        return (it != bloques_.end() && it->clave == k) ? &*it : nullptr;
+    }
+    ContenedorRoaring& obtener(std::uint16_t k) {
+        auto it = posicion(k);
+        if (it == bloques_.end() || it->clave != k) {
+            ContenedorRoaring c;
+            c.clave = k;
+            it = bloques_.insert(it, std::move(c));
+        }
+        return *it;
+    }
+
+    // Mezcla de las dos listas de bloques por clave
+    static ConjuntoComprimido combinar(OpRoaring op, const ConjuntoComprimido& a, const ConjuntoComprimido& b) {
+        const bool solo_a = (op != OpRoaring::Interseccion);      // Bloque solo en a: se conserva
+        const bool solo_b = (op == OpRoaring::Union || op == OpRoaring::DifSimetrica);
+        ConjuntoComprimido r;
+        r.bloques_.reserve(a.bloques_.size() + (solo_b ? b.bloques_.size() : 0));
+        std::size_t i = 0, j = 0;
+        while (i < a.bloques_.size() || j < b.bloques_.size()) {
+            if (j == b.bloques_.size() || (i < a.bloques_.size() && a.bloques_[i].clave < b.bloques_[j].clave)) {
+                if (solo_a) r.bloques_.push_back(a.bloques_[i]);
+                i++;
+            } else if (i == a.bloques_.size() || b.bloques_[j].clave < a.bloques_[i].clave) {
+                if (solo_b) r.bloques_.push_back(b.bloques_[j]);
+                j++;
+            } else {
+                ContenedorRoaring c = roaring_op(op, a.bloques_[i++], b.bloques_[j++]);
+                if (c.card) r.bloques_.push_back(std::move(c));
+            }
+        }
+        return r;
+    }
+};
+
+namespace std {
+template <std::size_t N>
+struct hash<ConjuntoComprimido<N>> {
+    std::size_t operator()(const ConjuntoComprimido<N>& c) const { return c.hash(); }
+};
+}
@@ -0,0 +1,54 @@
+//----------------------------------------------------------------------
+// consulta.hpp
+//----------------------------------------------------------------------
+// Consulta puntual: la expresión con menos operaciones que alcanza
+// Jaccard >= tau (y, opcionalmente, |H| <= m), sin calcular el frente.
+//----------------------------------------------------------------------
+//
+// Profundización por número de operaciones: el nivel s se construye
+// combinando los niveles a y s - 1 - a, como en la exhaustiva, y cada
+// expresión se comprueba al generarla, así que la primera que cumple
+// la restricción tiene el mínimo de operaciones y la búsqueda termina
+// ahí. Podas:
+//   - cota de átomos (atomos.hpp): si ninguna unión de átomos llega a
+//     tau, no hay solución para ningún k y no se genera nada
+//   - |H| > m: |H| no decrece al combinar, se descarta la subexpresión
+//   - conjuntos repetidos: de cada conjunto (y de cada conjunto con los
+//     mismos F_i usados, si hay límite de |H|) se guarda solo la
+//     primera expresión, que es la de menos operaciones
+//   - (A op B) igual a A o a B no aporta nada nuevo
+//   - ∪ y ∩ son conmutativos: cada par se combina una sola vez
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "atomos.hpp"
+#include "domain.hpp"
+#include "solutions.hpp"
+
+//------------------------------------------------------------------
+// Parámetros y resultado
+//------------------------------------------------------------------
+struct ParametrosConsulta {
+    double tau = 1.0;       // Jaccard mínimo
+    int max_sizeH = -1;     // |H| máximo (-1 = sin límite)
+    int max_ops = 3;        // Profundidad máxima (k)
+};
+
+struct ResultadoConsulta {
+    bool encontrada = false;
+    SolMO solucion;                 // Válida si encontrada
+    double cota = 0.0;              // Cota de átomos del Jaccard
+    int niveles = 0;                // Niveles (n_ops) explorados
+    std::size_t expresiones = 0;    // Expresiones generadas y evaluadas
+};
+
+ResultadoConsulta consulta_min_ops(
+    const std::vector<Bitset>& F,
+    const Bitset& U,
+    const Bitset& G,
+    const ParametrosConsulta& params,
+    const TablaAtomos* atomos = nullptr);   // nullptr => se calculan
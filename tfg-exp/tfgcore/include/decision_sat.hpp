@@ -0,0 +1,64 @@
+//----------------------------------------------------------------------
+// decision_sat.hpp
+//----------------------------------------------------------------------
+// Decisión exacta: ¿existe una expresión con <= k operaciones sobre F
+// y U cuyo conjunto es exactamente G (Jaccard = 1)? Se codifica en CNF
+// y se resuelve con el CDCL de sat.hpp, devolviendo la expresión
+// testigo si existe.
+//----------------------------------------------------------------------
+//
+// Codificación (programa de k pasos sobre los átomos de F, atomos.hpp):
+//   - nodos 0..|F|: U y F_0..F_{|F|-1}; nodos |F|+1+j: paso j
+//   - por paso: operando izquierdo y derecho (uno de los nodos
+//     anteriores, exactamente uno cada uno) y operación (∪, ∩ o \)
+//   - por paso y átomo: valor de cada operando y del resultado, ligado
+//     a la operación elegida
+//   - árbol, no DAG: cada paso se usa a lo sumo una vez (como operando
+//     de un paso posterior o como salida), así que los pasos usados
+//     forman el árbol de la expresión y n_ops <= k
+//   - salida: algún nodo igual a G en todos los átomos
+//   - simetrías: en ∪ y ∩ el operando izquierdo tiene índice menor
+// Si G parte algún átomo, ninguna expresión lo alcanza y no se llama
+// al resolutor.
+//
+// Modo incremental: se codifica una vez para k y se resuelve con k' =
+// 0, 1, ..., k fijando por supuestos que la salida esté entre los
+// nodos de los k' primeros pasos; el primer k' satisfacible es el
+// mínimo de operaciones y las cláusulas aprendidas se reutilizan.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "domain.hpp"
+#include "expr.hpp"
+#include "sat.hpp"
+
+//------------------------------------------------------------------
+// Parámetros y resultado
+//------------------------------------------------------------------
+struct ParametrosDecision {
+    int max_ops = 3;                    // k
+    bool incremental = true;            // Probar k' = 0..k (testigo mínimo)
+    long long max_conflictos = -1;      // Por llamada al resolutor (-1 = sin límite)
+};
+
+struct ResultadoDecision {
+    EstadoSAT estado = EstadoSAT::DESCONOCIDO;  // SAT: existe expresión (<= k ops) igual a G
+    Expression testigo;                         // Válido si SAT
+    std::vector<EstadoSAT> por_k;               // Incremental: resultado de cada k'
+    int atomos = 0;
+    int variables = 0;
+    int clausulas = 0;
+    EstadisticasSAT sat;
+};
+
+ResultadoDecision decidir_exacto(
+    const std::vector<Bitset>& F,
+    const Bitset& U,
+    const Bitset& G,
+    const ParametrosDecision& params);
+
+// "SI" / "NO" / "DESCONOCIDO"
+const char* nombre_estado(EstadoSAT e);
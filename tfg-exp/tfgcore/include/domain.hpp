@@ -10,6 +10,8 @@
 #include <string>
 #include <stdexcept>
 
+#include "comprimido.hpp"
+
 //------------------------------------------------------------------
 // Tamaño del universo
 //------------------------------------------------------------------
@@ -18,8 +20,14 @@
 #endif
 constexpr int U_size = U_SIZE;
 
-// Nombre para el conjunto sobre el universo U
+// Nombre para el conjunto sobre el universo U. Con TFG_CONJUNTO_COMPRIMIDO
+// se usa el conjunto comprimido (comprimido.hpp), para universos grandes
+// con conjuntos dispersos.
+#ifdef TFG_CONJUNTO_COMPRIMIDO
+using Bitset = ConjuntoComprimido<U_size>;
+#else
 using Bitset = std::bitset<U_size>;
+#endif
 
 //------------------------------
 // Operaciones básicas
@@ -30,11 +38,22 @@ inline Bitset set_union(const Bitset& A, const Bitset& B)      { return A | B; }
 // Intersección de conjuntos: A ∩ B
 inline Bitset set_intersect(const Bitset& A, const Bitset& B)  { return A & B; }
 // Diferencia de conjuntos: A \ B
+#ifdef TFG_CONJUNTO_COMPRIMIDO
+inline Bitset set_difference(const Bitset& A, const Bitset& B) { return diferencia(A, B); }
+#else
 inline Bitset set_difference(const Bitset& A, const Bitset& B) { return A & (~B); }
+#endif
 // Aplica la operación indicada
 inline Bitset apply_op(const int op, const Bitset& A, const Bitset& B) {
     if (op == 0) return set_union(A, B);
     if (op == 1) return set_intersect(A, B);
     if (op == 2) return set_difference(A, B);
     throw std::invalid_argument("Operación inválida");
+}
+
+// Texto de la operación en las expresiones: " ∪ ", " ∩ " o " \ "
+inline const char* texto_op(const int op) {
+    static const char* const TEXTO[3] = {" ∪ ", " ∩ ", " \\ "};
+    if (op < 0 || op > 2) throw std::invalid_argument("Operación inválida");
+    return TEXTO[op];
 }
\ No newline at end of file
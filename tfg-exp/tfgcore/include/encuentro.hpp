@@ -0,0 +1,48 @@
+//----------------------------------------------------------------------
+// encuentro.hpp
+//----------------------------------------------------------------------
+// Búsqueda bidireccional (meet-in-the-middle) de una expresión cuyo
+// conjunto es exactamente G, pensada para las instancias ground truth.
+//----------------------------------------------------------------------
+//
+// 0. Si G no es unión de átomos (atomos.hpp), no hay solución.
+// 1. Tabla: los conjuntos distintos alcanzables con <= h = k / 2
+//    operaciones (uno por conjunto, el de menos operaciones), indexados
+//    por hash. Si G está en la tabla, esa es la solución.
+// 2. Encuentro: G = X op Y con X e Y en la tabla. Fijado X, el
+//    compañero tiene que estar en un intervalo [inf, sup]:
+//      X ∪ Y = G   X ⊆ G,  Y en [G \ X, G]
+//      X ∩ Y = G   G ⊆ X,  Y en [G, G ∪ (U \ X)]
+//      X \ Y = G   G ⊆ X,  Y en [X \ G, U \ G]
+//    Primero se busca por hash el extremo inferior de cada intervalo
+//    (el compañero más habitual) y después, para asegurar el mínimo de
+//    operaciones, se recorren los pares de las listas filtradas (Y ⊆ G,
+//    Y ⊇ G, Y ∩ G = ∅) podando por la mejor solución encontrada.
+//
+// Encuentra toda expresión de <= k operaciones cuyos dos subárboles de
+// la raíz tengan <= h operaciones, con la memoria de una exhaustiva de
+// profundidad h: aproximadamente el doble de profundidad que la
+// búsqueda hacia delante.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "domain.hpp"
+#include "expr.hpp"
+
+struct ResultadoEncuentro {
+    bool encontrada = false;
+    Expression expresion;           // Válida si encontrada (conjunto == G)
+    int profundidad_tabla = 0;      // h
+    std::size_t tabla = 0;          // Conjuntos distintos en la tabla
+    std::size_t pares = 0;          // Pares (X, Y) comprobados
+};
+
+ResultadoEncuentro busqueda_encuentro(
+    const std::vector<Bitset>& F,
+    const Bitset& U,
+    const Bitset& G,
+    int k);
@@ -6,9 +6,12 @@
 
 #pragma once
 
+#include <cstdint>
+#include <string>
 #include <vector>
 #include <random>
 #include "domain.hpp"
+#include "instance_io.hpp"
 
 // -----------------------------------------------------------------------------
 // Parámetros de generación
@@ -30,4 +33,30 @@ Bitset generar_G(int n, int tam_min, int seed = 456);
 // Generar familia F
 // -----------------------------------------------------------------------------
 std::vector<Bitset> generar_F(int n, int n_min, int n_max,
-                              int tam_min, int tam_max, int seed = 123);
\ No newline at end of file
+                              int tam_min, int tam_max, int seed = 123);
+
+// -----------------------------------------------------------------------------
+// Generador escalable para universos grandes
+// -----------------------------------------------------------------------------
+// Muestreo sin reemplazo (algoritmo de Floyd), cada F_i con su propia
+// semilla derivada de 'seed' (resultado independiente del número de hilos).
+// La salida se empaqueta en palabras de 64 bits, sin límite U_size.
+// -----------------------------------------------------------------------------
+struct GenEscalableConfig {
+    std::uint64_t n = 1000000;          // Tamaño del universo
+    int F_n = 100;                      // Número de conjuntos en F
+    std::uint64_t Fi_size_min = 100;    // Tamaño mínimo de cada F_i
+    std::uint64_t Fi_size_max = 1000;   // Tamaño máximo de cada F_i
+    std::uint64_t G_size_min = 100;     // Tamaño mínimo de G
+    std::uint64_t G_size_max = 1000;    // Tamaño máximo de G
+    double solapamiento = 0.0;          // Fracción de G tomada de la unión de F (resto fuera de ella)
+    double correlacion = 0.0;           // Fracción de cada F_i tomada del centro de su grupo
+    int num_grupos = 1;                 // Grupos de conjuntos correlacionados (F_i va al grupo i % num_grupos)
+    int hilos = 0;                      // 0 => hardware_concurrency
+    std::uint64_t seed = 123;           // Semilla base
+};
+
+InstanciaEmpaquetada generar_instancia_escalable(const GenEscalableConfig& cfg);
+
+// Genera y escribe directamente en formato binario (instance_io.hpp)
+void generar_instancia_escalable(const GenEscalableConfig& cfg, const std::string& path);
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <vector>
 #include <random>
 
@@ -24,11 +25,31 @@ struct GAParams {
     int tournament_size = 2;        // Tamaño del torneo para selección
     int time_limit_sec = 300;       // Límite de tiempo en segundos
     uint64_t seed = 0;              // 0 => semilla aleatoria
+    double memetica_frac = 0.0;     // Fracción del primer frente mejorada por búsqueda local (0 = desactivada)
+    int memetica_pasos = 10;        // Pasos de escalada por individuo
+    bool simplificar = false;       // Simplificar y canonizar los hijos (simplificacion.hpp)
+    int max_reintentos = 50;        // Hijos repetidos seguidos antes de inyectar diversidad
+    bool seleccion_hv = false;      // Truncar el último frente por contribución al HV (SMS-EMOA)
 
     // Constructor por defecto
     GAParams() = default;
 };
 
+//------------------------------------------------------------------
+/* Contadores de una ejecución. Si el espacio de expresiones es
+    pequeño, los hijos repetidos se sustituyen por inmigrantes
+    aleatorios o mutaciones de la población y, si tampoco son nuevos,
+    la generación sigue con menos hijos (huecos vacíos). */
+//------------------------------------------------------------------
+struct EstadisticasGA {
+    int generaciones = 0;
+    std::size_t duplicados = 0;     // Individuos rechazados por repetir expresión
+    std::size_t inmigrantes = 0;    // Hijos sustituidos por individuos aleatorios
+    std::size_t mutantes = 0;       // Hijos sustituidos por mutaciones de la población
+    std::size_t huecos_vacios = 0;  // Hijos que no se pudieron generar
+    std::vector<double> hipervolumen; // Hipervolumen de la población tras cada generación
+};
+
 //------------------------------------------------------------------
 // Algoritmo NSGA-II
 //------------------------------------------------------------------
@@ -37,7 +58,27 @@ std::vector<Individuo> nsga2(
     const Bitset& U,
     const Bitset& G,
     int k,
-    const GAParams& params);
+    const GAParams& params,
+    EstadisticasGA* stats = nullptr);
+
+//------------------------------------------------------------------
+/* NSGA-II sembrado: la población inicial empieza por 'semillas' (sin
+    repetir, hasta population_size) y se completa aleatoriamente. Si
+    poblacion_final no es nulo, recibe la última población (útil como
+    semillas de la siguiente ejecución, ver incremental.hpp). Si
+    bloques_base no es nulo, son los de construir_bloques_base ya
+    puntuados para G (p. ej. residentes en el servidor). */
+//------------------------------------------------------------------
+std::vector<Individuo> nsga2_desde(
+    const std::vector<Bitset>& F,
+    const Bitset& U,
+    const Bitset& G,
+    int k,
+    const GAParams& params,
+    const std::vector<Individuo>& semillas,
+    std::vector<Individuo>* poblacion_final = nullptr,
+    EstadisticasGA* stats = nullptr,
+    const std::vector<SolMO>* bloques_base = nullptr);
     
 //------------------------------------------------------------------
 // Construcción aleatoria de expresiones (individuos)
@@ -52,13 +93,19 @@ Expression build_random_expr(
 //------------------------------------------------------------------
 // Utilidades NSGA-II
 //------------------------------------------------------------------
+// Bloques base F_0..F_{n-1} y U (U = -1 en used_sets) evaluados sobre G
+std::vector<SolMO> construir_bloques_base(const std::vector<Bitset>& F, const Bitset& U, const Bitset& G);
+// Recalcula el Jaccard de unos bloques base ya construidos para otro G
+void puntuar_bloques_base(std::vector<SolMO>& bloques, const Bitset& G);
 // Fast Non-Dominated Sort
 std::vector<std::vector<Individuo>> fast_non_dominated_sort(std::vector<Individuo>& poblacion);
 // Cálculo de Crowding Distance
 void calcular_crowding_distance(std::vector<Individuo>& frente);
-// Inicializar población
+/* Inicializar población: se detiene antes de pop_size si encadena
+    max_reintentos expresiones repetidas (espacio agotado) */
 std::vector<Individuo> inicializar_poblacion(const vector<Bitset>& F, const Bitset& U,
-                                        const Bitset& G, int k, int pop_size, mt19937& rng);
+                                        const Bitset& G, int k, int pop_size, mt19937& rng,
+                                        int max_reintentos = 1000, std::size_t* duplicados = nullptr);
 
 //------------------------------------------------------------------
 // Operadores Genéticos
@@ -7,18 +7,50 @@
 #ifndef GREEDY_HPP
 #define GREEDY_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include "expr.hpp"
 #include "domain.hpp"
 #include "solutions.hpp"
 
 // ------------------------------------------------------------------
-// Búsqueda greedy multi-objetivo
+/* Precribado (muestreo.hpp): de cada candidato se calcula primero una
+    cota superior de su Jaccard a partir de resúmenes de sus operandos
+    y, si ni con ella entraría en el frente (lo domina el frente global
+    o un candidato exacto del mismo nivel), se descarta sin construir su
+    conjunto ni evaluarlo. Con delta = 0 las cotas son deterministas y
+    el frente devuelto es exacto. Con delta > 0 se añade una cota
+    muestral que falla con probabilidad <= delta por candidato: el
+    frente es aproximado (puede perder candidatos no dominados). */
+// ------------------------------------------------------------------
+struct PrecribadoGreedy {
+    double delta = 0.0;         // 0: exacto; > 0: probabilidad de fallo de la cota muestral
+    std::uint64_t seed = 1;     // Semilla de la muestra (solo con delta > 0)
+};
+
+struct EstadisticasPrecribado {
+    std::size_t candidatos = 0;     // Candidatos generados
+    std::size_t descartados = 0;    // Descartados por la cota
+    std::size_t exactos = 0;        // Evaluados de forma exacta
+};
+
+// ------------------------------------------------------------------
+// Bloques base del greedy: F_0..F_{n-1} y U (sin conjuntos usados)
+// ------------------------------------------------------------------
+std::vector<SolMO> bloques_base_greedy(const std::vector<Bitset>& F, const Bitset& U, const Bitset& G);
+
+// ------------------------------------------------------------------
+/* Búsqueda greedy multi-objetivo. Si bloques_base no es nulo, son los
+    de bloques_base_greedy ya puntuados para G. */
 // ------------------------------------------------------------------ 
 std::vector<SolMO> greedy_multiobjective_search(
     const std::vector<Bitset>& F,
     const Bitset& U,
     const Bitset& G,
-    int k);
+    int k,
+    const PrecribadoGreedy* precribado = nullptr,
+    EstadisticasPrecribado* stats = nullptr,
+    const std::vector<SolMO>* bloques_base = nullptr);
 
 #endif // GREEDY_HPP
\ No newline at end of file
@@ -0,0 +1,76 @@
+//----------------------------------------------------------------------
+// hibrido.hpp
+//----------------------------------------------------------------------
+// Tubería híbrida: greedy -> NSGA-II sembrado -> búsqueda local.
+//----------------------------------------------------------------------
+//
+// 1. El greedy da en milisegundos un frente de partida.
+// 2. La población inicial del NSGA-II se siembra con ese frente y con
+//    mutaciones de cada solución; el resto se completa al azar.
+// 3. El frente final se pule con una búsqueda local de Pareto acotada
+//    (por rondas y por evaluaciones): cada solución se extiende con un
+//    bloque base más (a ambos lados y con las tres operaciones) y se
+//    combina con el resto del frente y con la última población del
+//    genético, mientras quepa en k.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "domain.hpp"
+#include "genetico.hpp"
+#include "solutions.hpp"
+
+//------------------------------------------------------------------
+// Parámetros de la tubería
+//------------------------------------------------------------------
+struct HibridoParams {
+    GAParams ga;                        // NSGA-II (time_limit_sec, max_generations, ...)
+    int mutantes_por_semilla = 3;       // Mutaciones de cada solución greedy en la población inicial
+    int max_rondas_local = 10;          // Rondas de búsqueda local (0 = sin búsqueda local)
+    std::size_t max_evaluaciones_local = 200000; // Presupuesto de evaluaciones de la búsqueda local
+};
+
+//------------------------------------------------------------------
+// Estadísticas de una ejecución
+//------------------------------------------------------------------
+struct EstadisticasHibrido {
+    long long ms_greedy = 0;
+    long long ms_genetico = 0;
+    long long ms_local = 0;
+    std::size_t semillas = 0;           // Individuos sembrados en el NSGA-II
+    std::size_t evaluaciones_local = 0; // Vecinos evaluados en la búsqueda local
+    std::size_t mejoras_local = 0;      // Vecinos que entraron en el frente
+};
+
+//------------------------------------------------------------------
+// Tubería completa
+//------------------------------------------------------------------
+std::vector<Individuo> hibrido(
+    const std::vector<Bitset>& F,
+    const Bitset& U,
+    const Bitset& G,
+    int k,
+    const HibridoParams& params,
+    EstadisticasHibrido* stats = nullptr);
+
+//------------------------------------------------------------------
+/* Búsqueda local de Pareto sobre 'frente'. Cada ronda explora los
+    vecinos de las soluciones que entraron en la ronda anterior
+    (extensiones con bloques base y combinaciones con el frente y con
+    'companeros'); se detiene sin novedades, tras max_rondas o al
+    agotar max_evaluaciones. Devuelve el frente no dominado del archivo
+    resultante. */
+//------------------------------------------------------------------
+std::vector<Individuo> busqueda_local(
+    const std::vector<Individuo>& frente,
+    const std::vector<Individuo>& companeros,
+    const std::vector<Bitset>& F,
+    const Bitset& U,
+    const Bitset& G,
+    int k,
+    int max_rondas,
+    std::size_t max_evaluaciones,
+    EstadisticasHibrido* stats = nullptr);
@@ -0,0 +1,125 @@
+//----------------------------------------------------------------------
+// incremental.hpp
+//----------------------------------------------------------------------
+// Re-resolución incremental cuando cambia la familia F (G y k fijos):
+// greedy que solo recalcula las combinaciones que tocan conjuntos
+// cambiados y arranque en caliente del genético con los supervivientes.
+//----------------------------------------------------------------------
+//
+// Cada conjunto tiene un id estable (su posición al crearse; los ids
+// eliminados no se reutilizan). Los resultados se devuelven con los
+// nombres habituales F<i>, donde i es la posición en la familia
+// compactada (ids activos en orden), igual que si se ejecutara
+// greedy_multiobjective_search sobre familia_actual().
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "domain.hpp"
+#include "expr.hpp"
+#include "niveles.hpp"
+#include "solutions.hpp"
+
+//------------------------------------------------------------------
+// Cambio sobre la familia F
+//------------------------------------------------------------------
+struct CambioF {
+    enum Tipo { Anadir, Eliminar, Modificar };
+    Tipo tipo = Anadir;
+    int id = -1;            // Eliminar / Modificar: id estable
+    Bitset conjunto;        // Anadir / Modificar: nuevo contenido
+};
+
+//------------------------------------------------------------------
+/* Resumen de un lote de cambios en índices compactos:
+    mapa[i_anterior] = índice nuevo (-1 si se eliminó) y
+    tocado[i_anterior] = true si su contenido cambió. */
+//------------------------------------------------------------------
+struct ResumenCambios {
+    std::vector<int> mapa;
+    std::vector<char> tocado;
+    std::vector<int> anadidos;  // Ids estables de los conjuntos añadidos
+};
+
+//------------------------------------------------------------------
+// Estado del greedy incremental
+//------------------------------------------------------------------
+struct EstadoGreedy {
+    Bitset U, G;
+    int k = 0;
+
+    // Familia por id estable
+    std::vector<Bitset> F;
+    std::vector<char> activo;
+    std::vector<SolMO> bloques;         // Bloque base de cada id (nombre F<id>)
+    SolMO bloque_U;
+
+    /* Combinaciones ya evaluadas por nivel: para cada expresión
+        izquierda del frente, los objetivos de sus hijos por operación y
+        bloque derecho (hueco 0 = U, hueco id + 1 = F<id>). La expresión
+        solo se construye si el hijo llega al frente. */
+    struct Hijos {
+        std::set<int> usados_izq;
+        std::array<std::vector<CandidataNivel>, 3> cand;
+        std::array<std::vector<char>, 3> valido;
+        bool en_frente = false;
+    };
+    std::vector<std::unordered_map<std::string, Hijos>> niveles;
+
+    std::vector<SolMO> frente;          // Último resultado (nombres compactos)
+    bool sucio = true;                  // Hay cambios sin resolver
+
+    // Contadores del último greedy_incremental
+    std::size_t evaluadas = 0;          // Combinaciones calculadas
+    std::size_t reutilizadas = 0;       // Combinaciones tomadas de la caché
+};
+
+// Estado inicial (aún sin resolver) para F, U, G y k
+EstadoGreedy greedy_estado_inicial(const std::vector<Bitset>& F, const Bitset& U, const Bitset& G, int k);
+
+// Aplica un lote de cambios e invalida solo lo que depende de ellos
+ResumenCambios aplicar_cambios(EstadoGreedy& estado, const std::vector<CambioF>& cambios);
+
+// Resuelve (reutilizando la caché) y devuelve el frente
+const std::vector<SolMO>& greedy_incremental(EstadoGreedy& estado);
+
+// Familia compactada (ids activos en orden)
+std::vector<Bitset> familia_actual(const EstadoGreedy& estado);
+
+//------------------------------------------------------------------
+// Renombrado de conjuntos en expresiones
+//------------------------------------------------------------------
+/* Sustituye F<i> por F<mapa[i]> en expr_str y used_sets (U = -1 se
+    conserva). Devuelve false si usa algún i con mapa[i] < 0. */
+bool renombrar_conjuntos(Expression& e, const std::vector<int>& mapa);
+
+//------------------------------------------------------------------
+/* Supervivientes para el arranque en caliente del genético: los
+    individuos de la población anterior que no usan conjuntos
+    eliminados ni modificados, renombrados a los índices nuevos. */
+//------------------------------------------------------------------
+template<typename T>
+std::vector<T> supervivientes(const std::vector<T>& poblacion, const ResumenCambios& r) {
+    std::vector<T> vivos;
+    vivos.reserve(poblacion.size());
+    for (const auto& ind : poblacion) {
+        bool tocado = false;
+        for (int i : ind.expr.used_sets) {
+            if (i >= 0 && (i >= (int)r.tocado.size() || r.tocado[i] || r.mapa[i] < 0)) {
+                tocado = true;
+                break;
+            }
+        }
+        if (tocado) continue;
+        T copia = ind;
+        if (renombrar_conjuntos(copia.expr, r.mapa)) vivos.push_back(std::move(copia));
+    }
+    return vivos;
+}
@@ -0,0 +1,119 @@
+//----------------------------------------------------------------------
+// indicadores.hpp
+//----------------------------------------------------------------------
+// Indicadores de calidad de frentes de Pareto (hipervolumen).
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "solutions.hpp"
+
+//------------------------------------------------------------------
+/* Punto de referencia normalizado a partir de k y |F|:
+    n_ops en [0, k], |H| en [0, min(|F| + 1, k + 1)] (U cuenta como
+    conjunto en el genético) y Jaccard en [0, 1]. La referencia es
+    (k + 1, max_sizeH + 1, 0). */
+//------------------------------------------------------------------
+struct ReferenciaHV {
+    int max_ops = 0;        // Máximo de operaciones (k)
+    int max_sizeH = 0;      // Máximo de conjuntos distintos
+};
+
+inline ReferenciaHV referencia_hv(int k, int num_F) {
+    ReferenciaHV r;
+    r.max_ops = std::max(0, k);
+    r.max_sizeH = std::max(1, std::min(num_F + 1, k + 1));
+    return r;
+}
+
+//------------------------------------------------------------------
+/* Hipervolumen exacto (3 objetivos), normalizado a [0, 1].
+    n_ops y |H| son enteros, así que el volumen dominado es una suma
+    sobre la rejilla (n_ops, |H|) del mejor Jaccard que domina cada
+    celda: O(|frente| + k * max_sizeH). Los puntos fuera de la
+    referencia se ignoran. */
+//------------------------------------------------------------------
+template<typename T>
+double hipervolumen(const std::vector<T>& frente, const ReferenciaHV& ref) {
+    const int no = ref.max_ops + 1, nh = ref.max_sizeH + 1;
+    std::vector<double> mejor((size_t)no * nh, 0.0);
+
+    // Mejor Jaccard en cada celda
+    for (const auto& s : frente) {
+        if (s.n_ops < 0 || s.sizeH < 0 || s.n_ops >= no || s.sizeH >= nh) continue;
+        double& m = mejor[(size_t)s.n_ops * nh + s.sizeH];
+        m = std::max(m, s.jaccard);
+    }
+
+    // Máximo prefijo en ambas dimensiones: celda (o, h) dominada por (o' <= o, h' <= h)
+    double volumen = 0.0;
+    for (int o = 0; o < no; o++) {
+        for (int h = 0; h < nh; h++) {
+            double& m = mejor[(size_t)o * nh + h];
+            if (o > 0) m = std::max(m, mejor[(size_t)(o - 1) * nh + h]);
+            if (h > 0) m = std::max(m, mejor[(size_t)o * nh + h - 1]);
+            volumen += m;
+        }
+    }
+    return volumen / ((double)no * nh);
+}
+
+template<typename T>
+double hipervolumen(const std::vector<T>& frente, int k, int num_F) {
+    return hipervolumen(frente, referencia_hv(k, num_F));
+}
+
+//------------------------------------------------------------------
+/* Contribución exclusiva de cada punto al hipervolumen (misma
+    normalización): HV(frente) - HV(frente sin el punto). En cada celda
+    de la rejilla se guardan los dos mejores Jaccard que la dominan
+    (de puntos distintos); una celda aporta (mejor - segundo) al punto
+    que da el mejor. Puntos repetidos o dominados aportan 0. */
+//------------------------------------------------------------------
+template<typename T>
+std::vector<double> contribuciones_hv(const std::vector<T>& frente, const ReferenciaHV& ref) {
+    const int no = ref.max_ops + 1, nh = ref.max_sizeH + 1;
+    struct Dos {
+        double v1 = 0.0, v2 = 0.0;  // Mejor y segundo mejor Jaccard
+        int id1 = -1, id2 = -1;     // Puntos que los dan (-1 = ninguno)
+        void anadir(double v, int id) {
+            // Un punto llega a la celda por varios caminos con el mismo valor
+            if (id < 0 || id == id1 || id == id2) return;
+            if (id1 < 0 || v > v1) {
+                v2 = v1; id2 = id1;
+                v1 = v; id1 = id;
+            } else if (id2 < 0 || v > v2) {
+                v2 = v; id2 = id;
+            }
+        }
+    };
+    std::vector<Dos> celda((size_t)no * nh);
+    for (int i = 0; i < (int)frente.size(); i++) {
+        const auto& s = frente[i];
+        if (s.n_ops < 0 || s.sizeH < 0 || s.n_ops >= no || s.sizeH >= nh) continue;
+        celda[(size_t)s.n_ops * nh + s.sizeH].anadir(s.jaccard, i);
+    }
+
+    std::vector<double> contrib(frente.size(), 0.0);
+    for (int o = 0; o < no; o++) {
+        for (int h = 0; h < nh; h++) {
+            Dos& c = celda[(size_t)o * nh + h];
+            if (o > 0) {
+                const Dos& a = celda[(size_t)(o - 1) * nh + h];
+                c.anadir(a.v1, a.id1);
+                c.anadir(a.v2, a.id2);
+            }
+            if (h > 0) {
+                const Dos& a = celda[(size_t)o * nh + h - 1];
+                c.anadir(a.v1, a.id1);
+                c.anadir(a.v2, a.id2);
+            }
+            if (c.id1 >= 0) contrib[c.id1] += c.v1 - (c.id2 >= 0 ? c.v2 : 0.0);
+        }
+    }
+    for (auto& x : contrib) x /= ((double)no * nh);
+    return contrib;
+}
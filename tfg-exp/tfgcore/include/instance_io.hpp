@@ -0,0 +1,150 @@
+//----------------------------------------------------------------------
+// instance_io.hpp
+//----------------------------------------------------------------------
+// Formato binario de instancias (versionado, mapeable en memoria)
+// y conversión desde el volcado de texto de print_conjuntos.
+//----------------------------------------------------------------------
+//
+// Disposición del fichero (little-endian, alineado a 8 bytes):
+//   CabeceraInstancia                     (64 bytes)
+//   G                                     (palabras_por_conjunto x u64)
+//   F_0 ... F_{num_F-1}                   (num_F x palabras_por_conjunto x u64)
+//   [sección gold, si flags & INSTANCIA_CON_GOLD]
+//     int32 n_ops, uint32 num_usados, int32 usados[num_usados],
+//     uint32 longitud, char expr_str[longitud]
+//
+// El bit i de un conjunto está en la palabra i/64, posición i%64.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "domain.hpp"
+#include "expr.hpp"
+#include "ground_truth.hpp"
+
+//------------------------------------------------------------------
+// Cabecera del formato
+//------------------------------------------------------------------
+constexpr char INSTANCIA_MAGIC[8] = {'T','F','G','I','N','S','T','\0'};
+constexpr std::uint32_t INSTANCIA_VERSION = 1;
+constexpr std::uint32_t INSTANCIA_CON_GOLD = 1u << 0;
+
+struct CabeceraInstancia {
+    char magic[8];                          // "TFGINST"
+    std::uint32_t version;                  // Versión del formato
+    std::uint32_t flags;                    // INSTANCIA_CON_GOLD, ...
+    std::uint64_t universo;                 // Tamaño del universo (bits)
+    std::uint64_t num_F;                    // Número de conjuntos en F
+    std::uint64_t palabras_por_conjunto;    // ceil(universo / 64)
+    std::uint64_t seed;                     // Semilla de generación (0 si no se conoce)
+    std::uint64_t offset_gold;              // Offset de la sección gold (0 si no hay)
+    std::uint64_t reservado;
+};
+static_assert(sizeof(CabeceraInstancia) == 64, "La cabecera debe ocupar 64 bytes");
+
+// Número de palabras de 64 bits para un universo de n elementos
+inline std::uint64_t palabras_para(std::uint64_t n) { return (n + 63) / 64; }
+
+//------------------------------------------------------------------
+// Expresión de referencia almacenada (sin bitset: es G)
+//------------------------------------------------------------------
+struct GoldGuardado {
+    std::string expr_str;
+    std::vector<int> used_sets;
+    int n_ops = 0;
+};
+
+//------------------------------------------------------------------
+// Instancia empaquetada en memoria (universo arbitrario)
+//------------------------------------------------------------------
+struct InstanciaEmpaquetada {
+    std::uint64_t universo = 0;                     // Tamaño del universo (bits)
+    std::vector<std::uint64_t> G;                   // Palabras de G
+    std::vector<std::vector<std::uint64_t>> F;      // Palabras de cada F_i
+    std::uint64_t seed = 0;                         // Semilla de generación
+};
+
+//------------------------------------------------------------------
+// Escritura
+//------------------------------------------------------------------
+// A partir de conjuntos ya empaquetados (universo arbitrario)
+void guardar_instancia_empaquetada(const std::string& path,
+                                   std::uint64_t universo,
+                                   const std::vector<std::uint64_t>& G,
+                                   const std::vector<std::vector<std::uint64_t>>& F,
+                                   const GoldGuardado* gold = nullptr,
+                                   std::uint64_t seed = 0);
+
+void guardar_instancia_empaquetada(const std::string& path,
+                                   const InstanciaEmpaquetada& inst);
+
+// A partir de Bitset (universo <= U_size)
+void guardar_instancia(const std::string& path,
+                       const std::vector<Bitset>& F,
+                       const Bitset& G,
+                       const Expression* gold = nullptr,
+                       std::uint64_t seed = 0,
+                       std::uint64_t universo = U_size);
+
+//------------------------------------------------------------------
+// Lectura mapeada en memoria (sin copia)
+//------------------------------------------------------------------
+class InstanciaMapeada {
+public:
+    explicit InstanciaMapeada(const std::string& path);
+    ~InstanciaMapeada();
+    InstanciaMapeada(const InstanciaMapeada&) = delete;
+    InstanciaMapeada& operator=(const InstanciaMapeada&) = delete;
+
+    const CabeceraInstancia& cabecera() const { return *cab_; }
+    std::uint64_t universo() const { return cab_->universo; }
+    std::uint64_t num_F() const { return cab_->num_F; }
+    std::uint64_t palabras() const { return cab_->palabras_por_conjunto; }
+    std::uint64_t seed() const { return cab_->seed; }
+
+    // Palabras de G y de F_i, directamente sobre el mapeo
+    const std::uint64_t* G() const { return datos_; }
+    const std::uint64_t* F(std::size_t i) const { return datos_ + (i + 1) * palabras(); }
+
+    bool tiene_gold() const { return (cab_->flags & INSTANCIA_CON_GOLD) != 0; }
+    GoldGuardado gold() const;
+
+private:
+    void* base_ = nullptr;                      // Inicio del mapeo
+    std::size_t tam_ = 0;                       // Tamaño del fichero
+    bool mapeado_ = false;                      // false => copia en memoria (sin mmap)
+    std::vector<unsigned char> copia_;
+    const CabeceraInstancia* cab_ = nullptr;
+    const std::uint64_t* datos_ = nullptr;
+};
+
+//------------------------------------------------------------------
+// Conversión a Bitset (requiere universo <= U_size)
+//------------------------------------------------------------------
+Bitset palabras_a_bitset(const std::uint64_t* w, std::uint64_t universo);
+// palabras_para(universo) palabras con los elementos < universo
+std::vector<std::uint64_t> bitset_a_palabras(const Bitset& b, std::uint64_t universo = U_size);
+
+// Conjunto universo {0, ..., universo - 1} (requiere universo <= U_size)
+Bitset universo_hasta(std::uint64_t universo);
+
+/* Carga completa como GroundTruthInstance (gold_expr vacía si no hay).
+    Si universo no es nulo, recibe el universo de la cabecera. */
+GroundTruthInstance cargar_instancia(const std::string& path, std::uint64_t* universo = nullptr);
+
+/* Objetivos G de un fichero de texto: uno por línea, elementos
+    separados por comas ("1,5,9"). Se ignoran las líneas vacías y lo que
+    sigue a '#'. Los elementos deben ser < universo. */
+std::vector<Bitset> cargar_objetivos(const std::string& path, std::uint64_t universo);
+
+//------------------------------------------------------------------
+/* Convierte el volcado de texto (salida de main, con o sin marcas
+    @@@REPRO_DATA_START@@@) al formato binario. */
+//------------------------------------------------------------------
+void convertir_texto_a_binario(const std::string& path_texto,
+                               const std::string& path_binario);
@@ -0,0 +1,83 @@
+//----------------------------------------------------------------------
+// mapelites.hpp
+//----------------------------------------------------------------------
+// MAP-Elites: la mejor expresión (Jaccard) de cada celda (n_ops, |H|).
+//----------------------------------------------------------------------
+//
+// El archivo es una rejilla fija de (k + 1) x (k + 2) celdas (|H| va de
+// 0, U sin contar, a k + 1 hojas distintas) guardada en un vector plano,
+// una élite por celda. Cada lote de hijos se genera en paralelo con los
+// operadores del genético (crossover / mutar) a partir de padres
+// elegidos al azar entre las celdas ocupadas, y cada hilo inserta sus
+// hijos en un ArchivoConcurrente (archivo_concurrente.hpp) con el mismo
+// orden por celda. Los hijos se reparten en bloques fijos con su propia
+// semilla, así que el resultado no depende del número de hilos.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "domain.hpp"
+#include "solutions.hpp"
+
+//------------------------------------------------------------------
+// Parámetros
+//------------------------------------------------------------------
+struct MapElitesParams {
+    int lote = 256;                 // Hijos por lote
+    int max_lotes = 1e9;            // Máximo de lotes
+    int time_limit_sec = 60;        // Límite de tiempo en segundos
+    int poblacion_inicial = 200;    // Individuos aleatorios iniciales
+    double crossover_prob = 0.5;    // Probabilidad de cruce
+    double mutation_prob = 0.5;     // Probabilidad de mutación (siempre si no hay cruce)
+    bool simplificar = false;       // Simplificar los hijos (simplificacion.hpp)
+    int hilos = 1;                  // Hilos de trabajo (0 = todos)
+    uint64_t seed = 0;              // 0 => semilla aleatoria
+};
+
+//------------------------------------------------------------------
+// Cobertura del archivo tras cada lote
+//------------------------------------------------------------------
+struct PuntoCobertura {
+    long long ms = 0;               // Tiempo desde el inicio
+    std::size_t evaluaciones = 0;   // Individuos evaluados hasta ahora
+    int celdas = 0;                 // Celdas ocupadas
+    double cobertura = 0.0;         // Ocupadas / alcanzables
+    double hipervolumen = 0.0;      // Hipervolumen de las élites
+};
+
+//------------------------------------------------------------------
+// Archivo de élites
+//------------------------------------------------------------------
+struct ArchivoElites {
+    int max_ops = 0;                // Filas: n_ops en [0, max_ops]
+    int max_sizeH = 0;              // Columnas: |H| en [0, max_sizeH]
+    int alcanzables = 0;            // Celdas con |H| <= min(n_ops + 1, |F| + 1)
+    std::vector<Individuo> elite;   // (max_ops + 1) * (max_sizeH + 1)
+    std::vector<char> ocupada;
+
+    int celda(int n_ops, int sizeH) const { return n_ops * (max_sizeH + 1) + sizeH; }
+
+    // Inserta si la celda está vacía o mejora su Jaccard; devuelve true si entra
+    bool insertar(const Individuo& ind);
+    // Élites de las celdas ocupadas, por n_ops y después |H|
+    std::vector<Individuo> elites() const;
+    int num_ocupadas() const;
+};
+
+struct ResultadoMapElites {
+    ArchivoElites archivo;
+    std::vector<PuntoCobertura> cobertura;
+    std::size_t evaluaciones = 0;
+    int lotes = 0;
+};
+
+ResultadoMapElites map_elites(
+    const std::vector<Bitset>& F,
+    const Bitset& U,
+    const Bitset& G,
+    int k,
+    const MapElitesParams& params);
@@ -0,0 +1,32 @@
+//----------------------------------------------------------------------
+// memetica.hpp
+//----------------------------------------------------------------------
+// Búsqueda local (escalada) sobre el árbol de un individuo.
+//----------------------------------------------------------------------
+//
+// Vecindario: cambiar una hoja por otro bloque base (F_i o U) o cambiar
+// la operación de un nodo interno. n_ops no cambia, así que un vecino
+// mejora si domina al individuo en (Jaccard, |H|).
+//
+// Evaluación incremental: solo se recalcula el camino de la hoja (o
+// nodo) cambiada hasta la raíz; el Jaccard sale de la raíz nueva con |G|
+// precalculado. |H| sigue el criterio de la expresión de entrada sobre
+// U (cuenta solo si está en used_sets), como simplificar_expresion.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "domain.hpp"
+#include "solutions.hpp"
+
+//------------------------------------------------------------------
+/* Escalada con primera mejora: aplica hasta max_pasos vecinos que
+    dominan al actual. Devuelve true si el individuo cambió (con la
+    expresión, used_sets y objetivos ya actualizados). Los individuos
+    cuya expresión no se puede analizar se dejan como están. */
+//------------------------------------------------------------------
+bool mejora_local_memetica(Individuo& ind, const std::vector<Bitset>& F, const Bitset& U,
+                           const Bitset& G, int max_pasos, std::size_t* vecinos_evaluados = nullptr);
@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <stdexcept>
 #include <algorithm>
+#include <vector>
 #include "domain.hpp"
 #include "expr.hpp"
 
@@ -63,3 +65,19 @@ inline bool is_maximization(Metric m) {
 // Evaluación de la métrica
 //-----------------------------------------------------------------
 double M(const Expression& H, const Bitset& G, Metric metric);
+
+//------------------------------------------------------------------
+/* Jaccard por lotes: evalúa H contra varios objetivos a la vez.
+    card_G[t] = |Gs[t]|; usa |H ∪ G| = |H| + |G| - |H ∩ G|. */
+//------------------------------------------------------------------
+void jaccard_lote(const Bitset& H, const std::vector<Bitset>& Gs,
+                  const std::vector<int>& card_G, double* out);
+
+//------------------------------------------------------------------
+/* Contador de evaluaciones de Jaccard (por hilo). Lo incrementan M()
+    con Metric::Jaccard, jaccard_lote (una por objetivo) y las
+    evaluaciones incrementales (contar_evaluaciones). */
+//------------------------------------------------------------------
+std::uint64_t evaluaciones_realizadas();
+void reiniciar_evaluaciones();
+void contar_evaluaciones(std::uint64_t n);
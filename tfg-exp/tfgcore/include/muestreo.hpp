@@ -0,0 +1,78 @@
+//----------------------------------------------------------------------
+// muestreo.hpp
+//----------------------------------------------------------------------
+// Cota superior del Jaccard de un candidato (A op B) a partir de
+// resúmenes de sus operandos, para descartar candidatos antes de
+// construir su conjunto en universos grandes.
+//----------------------------------------------------------------------
+//
+// El resumen de un conjunto X son |X ∩ G|, |X \ G| (exactos) y su
+// proyección sobre una muestra fija de elementos. Proyectar conmuta con
+// ∪, ∩ y \, así que la proyección del candidato se obtiene combinando
+// las de sus operandos sin tocar el conjunto completo.
+//
+// J(H, G) = |H ∩ G| / (|G| + |H \ G|), así que basta con una cota
+// superior de |H ∩ G| y una inferior de |H \ G|:
+//
+//   - La muestra empieza por todos los elementos de G si caben
+//     (|G| <= TAM_MUESTRA): |H ∩ G| es exacto. Si no, se acota con los
+//     cardinales de los operandos.
+//   - |H \ G| se acota por debajo con los cardinales de los operandos.
+//     Si todo U \ G cabe en el resto de la muestra, es exacto.
+//
+// Estas cotas son deterministas: el precribado no cambia el frente.
+// Con delta > 0 el resto de la muestra se llena con elementos de U \ G
+// elegidos al azar y |H \ G| se acota además con Chernoff (cota
+// relativa, que sigue siendo útil con conjuntos dispersos): cada cota
+// falla con probabilidad <= delta y el frente pasa a ser aproximado.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+#include "domain.hpp"
+
+//------------------------------------------------------------------
+// Muestra
+//------------------------------------------------------------------
+#ifndef TAM_MUESTRA_MAX
+#define TAM_MUESTRA_MAX 4096
+#endif
+constexpr int TAM_MUESTRA = U_size < TAM_MUESTRA_MAX ? U_size : TAM_MUESTRA_MAX;
+
+using Muestra = std::bitset<TAM_MUESTRA>;
+
+struct MuestraUniverso {
+    std::vector<int> elementos;     // Elementos de G (si caben) y después de U \ G
+    int num_G = 0;                  // Posiciones [0, num_G): G completo (0 si no cabe)
+    int card_G = 0;                 // |G|
+    std::uint64_t card_fuera = 0;   // |U \ G|
+    bool fuera_completo = false;    // Todo U \ G está en la muestra
+    double log_delta = 0.0;         // ln(1 / delta) de la cota relativa (0: desactivada)
+    Muestra G;                      // Posiciones de la muestra que son de G
+    Muestra fuera;                  // Posiciones de la muestra que son de U \ G
+};
+
+/* Muestra para el objetivo G dentro del universo U. delta = 0: solo
+    cotas deterministas; delta en (0, 1): también la cota relativa. */
+MuestraUniverso crear_muestra(const Bitset& G, const Bitset& U, double delta, std::uint64_t seed);
+
+Muestra proyectar(const Bitset& X, const MuestraUniverso& m);
+
+//------------------------------------------------------------------
+// Resúmenes y cota
+//------------------------------------------------------------------
+struct ResumenConjunto {
+    Muestra proy;                   // Proyección sobre la muestra
+    int dentro = 0;                 // |X ∩ G|
+    int fuera = 0;                  // |X \ G|
+};
+
+ResumenConjunto resumir(const Bitset& X, const Bitset& G, const MuestraUniverso& m);
+
+// Cota superior del Jaccard de (A op B) con G (op: 0 ∪, 1 ∩, 2 \)
+double cota_superior_jaccard(int op, const ResumenConjunto& A, const ResumenConjunto& B,
+                             const MuestraUniverso& m);
@@ -0,0 +1,183 @@
+//----------------------------------------------------------------------
+// niveles.hpp
+//----------------------------------------------------------------------
+// Niveles de expresiones en estructura de arrays y núcleo de
+// combinación por pares (izquierda x derecha) para la exhaustiva y el
+// greedy.
+//----------------------------------------------------------------------
+//
+// Un nivel guarda los conjuntos contiguos (vector<Bitset>) y aparte
+// las máscaras de conjuntos usados (|H| = popcount); la cadena y el
+// set<int> de cada expresión solo se construyen para las soluciones
+// que llegan al frente. El núcleo está especializado por operación
+// (sin rama por par) y recorre la derecha por bloques que caben en L1
+// mientras barre las filas de la izquierda. Cada par escribe en su
+// posición fila * |derecha| + columna, así que el resultado no depende
+// del orden del recorrido.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "domain.hpp"
+#include "solutions.hpp"
+
+//------------------------------------------------------------------
+// Objetivos de una candidata (sin expresión) e índice para rehacerla
+//------------------------------------------------------------------
+struct CandidataNivel {
+    double jaccard = 0.0;
+    int n_ops = 0;
+    int sizeH = 0;
+    std::size_t indice = 0;     // Posición en su nivel
+};
+
+inline bool dominates(const CandidataNivel& a, const CandidataNivel& b) {
+    bool ge = (a.jaccard >= b.jaccard) && (a.n_ops <= b.n_ops) && (a.sizeH <= b.sizeH);
+    bool gt = (a.jaccard >  b.jaccard) || (a.n_ops <  b.n_ops) || (a.sizeH <  b.sizeH);
+    return ge && gt;
+}
+
+// Jaccard con |G| precalculado: |H ∪ G| = |H| + |G| - |H ∩ G|
+inline double jaccard_con_cardinal(const Bitset& H, const Bitset& G, int card_G) {
+    const int inter = (int)(H & G).count();
+    const int uni = (int)H.count() + card_G - inter;
+    return uni == 0 ? 1.0 : (double)inter / uni;
+}
+
+//------------------------------------------------------------------
+// Nivel: conjuntos y máscaras de conjuntos usados (palabras por fila)
+//------------------------------------------------------------------
+struct NivelSoA {
+    int palabras = 1;                   // Palabras de 64 bits por máscara
+    std::vector<Bitset> conjuntos;
+    std::vector<std::uint64_t> mascaras;
+
+    std::size_t size() const { return conjuntos.size(); }
+    const std::uint64_t* mascara(std::size_t i) const { return mascaras.data() + i * palabras; }
+    void redimensionar(std::size_t n) {
+        conjuntos.resize(n);
+        mascaras.assign(n * palabras, 0);
+    }
+};
+
+inline int palabras_mascara(std::size_t num_F) { return (int)std::max<std::size_t>(1, (num_F + 63) / 64); }
+
+// Nivel 0 en el orden U, F_0, ..., F_{n-1} (U no usa ningún F_i)
+inline NivelSoA nivel_base(const std::vector<Bitset>& F, const Bitset& U) {
+    NivelSoA n;
+    n.palabras = palabras_mascara(F.size());
+    n.redimensionar(F.size() + 1);
+    n.conjuntos[0] = U;
+    for (std::size_t i = 0; i < F.size(); i++) {
+        n.conjuntos[i + 1] = F[i];
+        n.mascaras[(i + 1) * n.palabras + i / 64] = 1ull << (i % 64);
+    }
+    return n;
+}
+
+// Nivel con los conjuntos y las máscaras de conjuntos usados de una lista de soluciones
+inline NivelSoA nivel_de_soluciones(const std::vector<SolMO>& v, int palabras) {
+    NivelSoA n;
+    n.palabras = palabras;
+    n.redimensionar(v.size());
+    for (std::size_t i = 0; i < v.size(); i++) {
+        n.conjuntos[i] = v[i].expr.conjunto;
+        for (int f : v[i].expr.used_sets) n.mascaras[i * palabras + f / 64] |= 1ull << (f % 64);
+    }
+    return n;
+}
+
+// Bloque (op, a, b) de un nivel: sus pares ocupan [base, base + |a| * |b|)
+struct BloqueNivel {
+    int op, a, b;
+    std::size_t base;
+};
+
+/* Expresión de la posición idx del nivel s (solo para el frente). Los
+    niveles que no están guardados (vacíos o fuera de 'niveles') se
+    recalculan a partir de sus operandos. */
+inline Expression rehacer_expresion(const std::vector<NivelSoA>& niveles,
+                                    const std::vector<std::vector<BloqueNivel>>& bloques,
+                                    int s, std::size_t idx) {
+    if (s == 0) {
+        if (idx == 0) return Expression(niveles[0].conjuntos[0], "U", {}, 0);
+        const int i = (int)idx - 1;
+        return Expression(niveles[0].conjuntos[idx], "F" + std::to_string(i), {i}, 0);
+    }
+    const auto& bs = bloques[s];
+    const BloqueNivel& bl = *(std::upper_bound(bs.begin(), bs.end(), idx,
+        [](std::size_t x, const BloqueNivel& b) { return x < b.base; }) - 1);
+    const std::size_t n_der = niveles[bl.b].size();
+    const Expression L = rehacer_expresion(niveles, bloques, bl.a, (idx - bl.base) / n_der);
+    const Expression R = rehacer_expresion(niveles, bloques, bl.b, (idx - bl.base) % n_der);
+    const bool guardado = s < (int)niveles.size() && !niveles[s].conjuntos.empty();
+    Expression e(guardado ? niveles[s].conjuntos[idx] : apply_op(bl.op, L.conjunto, R.conjunto),
+                 "(" + L.expr_str + texto_op(bl.op) + R.expr_str + ")", L.used_sets, s);
+    e.used_sets.insert(R.used_sets.begin(), R.used_sets.end());
+    return e;
+}
+
+//------------------------------------------------------------------
+// Núcleo: filas [fila0, fila1) de izquierda x toda la derecha
+//------------------------------------------------------------------
+// Conjuntos de la derecha por bloque (unos 32 KiB con sus máscaras)
+inline std::size_t columnas_por_bloque(int palabras) {
+    return std::max<std::size_t>(1, (32u << 10) / (sizeof(Bitset) + 8 * (std::size_t)palabras));
+}
+
+template <int OP>
+inline Bitset aplicar_op_fija(const Bitset& A, const Bitset& B) {
+    if constexpr (OP == 0) return set_union(A, B);
+    else if constexpr (OP == 1) return set_intersect(A, B);
+    else return set_difference(A, B);
+}
+
+/* Candidata del par (i, j) en cand[(i - fila0) * |der| + j]. Si destino
+    no es nulo, el conjunto y la máscara se guardan en su posición
+    base_destino + i * |der| + j (niveles que aún se combinan). */
+template <int OP>
+void combinar_filas(const NivelSoA& izq, std::size_t fila0, std::size_t fila1,
+                    const NivelSoA& der, const Bitset& G, int card_G, int n_ops,
+                    CandidataNivel* cand, NivelSoA* destino, std::size_t base_destino) {
+    const std::size_t n_der = der.size();
+    const int P = izq.palabras;
+    const std::size_t bloque = columnas_por_bloque(P);
+    for (std::size_t j0 = 0; j0 < n_der; j0 += bloque) {
+        const std::size_t j1 = std::min(n_der, j0 + bloque);
+        for (std::size_t i = fila0; i < fila1; i++) {
+            const Bitset& A = izq.conjuntos[i];
+            const std::uint64_t* mA = izq.mascara(i);
+            for (std::size_t j = j0; j < j1; j++) {
+                const Bitset c = aplicar_op_fija<OP>(A, der.conjuntos[j]);
+                const std::uint64_t* mB = der.mascara(j);
+                int sizeH = 0;
+                for (int w = 0; w < P; w++) sizeH += __builtin_popcountll(mA[w] | mB[w]);
+
+                CandidataNivel& r = cand[(i - fila0) * n_der + j];
+                r.jaccard = jaccard_con_cardinal(c, G, card_G);
+                r.n_ops = n_ops;
+                r.sizeH = sizeH;
+                r.indice = base_destino + i * n_der + j;
+                if (destino) {
+                    destino->conjuntos[r.indice] = c;
+                    std::uint64_t* m = destino->mascaras.data() + r.indice * P;
+                    for (int w = 0; w < P; w++) m[w] = mA[w] | mB[w];
+                }
+            }
+        }
+    }
+}
+
+inline void combinar_filas_op(int op, const NivelSoA& izq, std::size_t fila0, std::size_t fila1,
+                              const NivelSoA& der, const Bitset& G, int card_G, int n_ops,
+                              CandidataNivel* cand, NivelSoA* destino, std::size_t base_destino) {
+    if (op == 0) combinar_filas<0>(izq, fila0, fila1, der, G, card_G, n_ops, cand, destino, base_destino);
+    else if (op == 1) combinar_filas<1>(izq, fila0, fila1, der, G, card_G, n_ops, cand, destino, base_destino);
+    else combinar_filas<2>(izq, fila0, fila1, der, G, card_G, n_ops, cand, destino, base_destino);
+}
@@ -0,0 +1,59 @@
+//----------------------------------------------------------------------
+// pool.hpp
+//----------------------------------------------------------------------
+// Pool de hilos con robo de trabajo (work-stealing).
+//----------------------------------------------------------------------
+//
+// Cada hilo tiene su propia cola: saca tareas de su extremo (LIFO) y,
+// cuando se queda sin trabajo, roba del extremo opuesto de las colas
+// de los demás (FIFO). Así se reparten bien tareas de duración muy
+// distinta sin un único cuello de botella.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class PoolTrabajo {
+public:
+    // hilos <= 0 => hardware_concurrency
+    explicit PoolTrabajo(int hilos = 0);
+    ~PoolTrabajo();
+    PoolTrabajo(const PoolTrabajo&) = delete;
+    PoolTrabajo& operator=(const PoolTrabajo&) = delete;
+
+    // Encola una tarea (en la cola del hilo actual si es un trabajador)
+    void enviar(std::function<void()> tarea);
+    // Espera a que terminen todas las tareas enviadas
+    void esperar();
+
+    int num_hilos() const { return (int)hilos_.size(); }
+
+private:
+    struct Cola {
+        std::mutex m;
+        std::deque<std::function<void()>> tareas;
+    };
+
+    void bucle(int id);
+    bool obtener(int id, std::function<void()>& tarea);
+
+    std::vector<std::unique_ptr<Cola>> colas_;
+    std::vector<std::thread> hilos_;
+
+    std::mutex m_;                          // Protege las esperas
+    std::condition_variable cv_trabajo_;    // Hay tareas en alguna cola
+    std::condition_variable cv_fin_;        // No quedan tareas pendientes
+    std::atomic<std::size_t> en_cola_{0};   // Tareas encoladas sin empezar
+    std::atomic<std::size_t> pendientes_{0};// Tareas encoladas o en ejecución
+    std::atomic<std::size_t> siguiente_{0}; // Reparto round-robin desde fuera del pool
+    bool parar_ = false;
+};
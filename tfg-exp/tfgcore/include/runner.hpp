@@ -0,0 +1,89 @@
+//----------------------------------------------------------------------
+// runner.hpp
+//----------------------------------------------------------------------
+// Ejecución de experimentos por lotes dentro de un único proceso:
+// manifiesto -> lista de ejecuciones -> pool de hilos -> CSV/JSONL.
+//----------------------------------------------------------------------
+//
+// Formato del manifiesto (una clave por línea, '#' para comentarios):
+//
+//   modo            = test                 # test | groundtruth
+//   seeds           = 1000..1019           # rango (inclusive) o lista 1000,1010
+//   k               = 3,5
+//   algo            = exhaustiva,greedy,genetico   # también hibrido
+//   G               = 10
+//   Fmin            = 5
+//   Fmax            = 15
+//   FsizeMin        = 5
+//   FsizeMax        = 40
+//   pop_size        = 150
+//   mutation_prob   = 0.5
+//   crossover_prob  = 0.8
+//   tournament_size = 5
+//   max_generations = 100
+//   time_limit      = 900
+//   seed_expr       = 1                    # por defecto: la semilla de la instancia
+//
+// Toda clave admite una lista de valores; se ejecuta el producto
+// cartesiano de todas ellas.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "genetico.hpp"
+
+//------------------------------------------------------------------
+// Configuración de una ejecución
+//------------------------------------------------------------------
+struct ConfigEjecucion {
+    int id = 0;                 // Posición en el manifiesto expandido
+    bool modo_test = true;      // true: instancia aleatoria; false: ground truth
+    int seed = 1002;            // Semilla de la instancia
+    int k = 3;                  // Máximo de operaciones
+    std::string algo = "greedy";// exhaustiva | greedy | genetico | hibrido
+    int G_size_min = 10;
+    int F_n_min = 5;
+    int F_n_max = 15;
+    int Fi_size_min = 5;
+    int Fi_size_max = 40;
+    GAParams ga;                // Parámetros del genético
+};
+
+//------------------------------------------------------------------
+// Resultado de una ejecución (una fila)
+//------------------------------------------------------------------
+struct ResultadoEjecucion {
+    ConfigEjecucion cfg;
+    int G_size = 0;
+    int F_count = 0;
+    long long tiempo_ms = 0;
+    std::uint64_t evaluaciones = 0;
+    int num_pareto = 0;
+    double mejor_jaccard = 0.0;
+    double hipervolumen = 0.0;
+    int hit = -1;               // Solo ground truth: 1 si se alcanza Jaccard = 1
+    std::string error;          // Mensaje si la ejecución falló
+};
+
+//------------------------------------------------------------------
+// Manifiesto
+//------------------------------------------------------------------
+std::vector<ConfigEjecucion> leer_manifiesto(const std::string& path);
+
+//------------------------------------------------------------------
+// Ejecución
+//------------------------------------------------------------------
+// Ejecuta una configuración (instancia + algoritmo)
+ResultadoEjecucion ejecutar_configuracion(const ConfigEjecucion& cfg);
+
+/* Ejecuta todas las configuraciones en un pool de 'hilos' trabajadores
+    y escribe cada fila al terminar (formato "csv" o "jsonl").
+    Devuelve el número de ejecuciones con error. */
+int ejecutar_manifiesto(const std::vector<ConfigEjecucion>& ejecuciones,
+                        const std::string& path_resultados,
+                        const std::string& formato,
+                        int hilos);
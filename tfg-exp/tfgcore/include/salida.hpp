@@ -0,0 +1,88 @@
+//----------------------------------------------------------------------
+// salida.hpp
+//----------------------------------------------------------------------
+// Escritura de resultados legibles por máquina (JSON, CSV, binario)
+// y del volcado de texto de instancias. Todo se compone en un buffer
+// en memoria y se escribe de una sola vez.
+//----------------------------------------------------------------------
+//
+// JSON:    {"semilla":..,"u_size":..,"instancia":{"G":[..],"F":[[..],..]},
+//           "frentes":[{"algoritmo":"..","tiempo_ms":..,"soluciones":
+//           [{"n_ops":..,"sizeH":..,"jaccard":..,"expr":".."},..]},..]}
+// CSV:     seccion,nombre,tiempo_ms,n_ops,sizeH,jaccard,valor
+//          (seccion = conjunto | solucion; valor = elementos o expresión)
+// Binario: "TFGRES1\0", u64 semilla, u32 u_size, y registros:
+//          u8 1 (instancia): u32 num_F, u32 palabras, G y F en u64
+//          u8 2 (frente):    u32 len, nombre, i64 tiempo_ms, u32 n, y por
+//                            solución i32 n_ops, i32 sizeH, f64 jaccard,
+//                            u32 len, expresión (len = 0 sin expresiones)
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "domain.hpp"
+#include "solutions.hpp"
+
+//------------------------------------------------------------------
+// Formato de salida
+//------------------------------------------------------------------
+enum class FormatoSalida { Texto, JSON, CSV, Binario };
+
+// "text" | "json" | "csv" | "bin"
+FormatoSalida leer_formato_salida(const std::string& s);
+
+//------------------------------------------------------------------
+// Volcado de texto de G y F (formato de print_conjuntos)
+//------------------------------------------------------------------
+void anadir_conjuntos_texto(std::string& out, const Bitset& G, const std::vector<Bitset>& F);
+
+// Objeto JSON de una solución: {"n_ops":..,"sizeH":..,"jaccard":..,"expr":".."}
+void anadir_solucion_json(std::string& out, const SolMO& s, bool con_expresion);
+
+// Texto JSON entre comillas (con escapes)
+void anadir_json_texto(std::string& out, const std::string& s);
+
+// Escribe el buffer en 'path' ("-" = salida estándar) con una sola escritura
+void escribir_buffer(const std::string& buffer, const std::string& path);
+
+//------------------------------------------------------------------
+// Escritor de resultados
+//------------------------------------------------------------------
+class EscritorResultados {
+public:
+    /* universo: el de la instancia (u_size y palabras por conjunto).
+        con_expresiones = false omite el texto de las expresiones
+        (solo objetivos), que es lo más costoso de serializar. */
+    EscritorResultados(FormatoSalida formato, uint64_t semilla, uint64_t universo,
+                       bool con_expresiones = true);
+
+    void instancia(const Bitset& G, const std::vector<Bitset>& F);
+
+    template<typename T>
+    void frente(const std::string& algoritmo, long long tiempo_ms, const std::vector<T>& soluciones) {
+        abrir_frente(algoritmo, tiempo_ms, soluciones.size());
+        for (size_t i = 0; i < soluciones.size(); i++) solucion(soluciones[i], i);
+        cerrar_frente();
+    }
+
+    // Cierra el documento y lo escribe en 'path' ("-" = salida estándar)
+    void volcar(const std::string& path);
+
+private:
+    void cabecera(uint64_t semilla);
+    void abrir_frente(const std::string& algoritmo, long long tiempo_ms, size_t n);
+    void solucion(const SolMO& s, size_t i);
+    void cerrar_frente();
+
+    FormatoSalida formato_;
+    uint64_t universo_;
+    bool con_expresiones_;
+    std::string buffer_;
+    std::string nombre_frente_;     // CSV: nombre y tiempo del frente abierto
+    long long tiempo_frente_ = 0;
+    int num_frentes_ = 0;           // JSON: separadores entre frentes
+};
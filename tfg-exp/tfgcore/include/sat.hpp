@@ -0,0 +1,98 @@
+//----------------------------------------------------------------------
+// sat.hpp
+//----------------------------------------------------------------------
+// Resolutor SAT CDCL mínimo (sin dependencias externas).
+//----------------------------------------------------------------------
+//
+// Literales al estilo DIMACS: la variable v (>= 1) es el literal v y
+// su negación -v. Incluye lo habitual de un CDCL pequeño:
+//   - dos literales vigilados por cláusula
+//   - aprendizaje por primer UIP con minimización local
+//   - VSIDS (montículo de actividades) y memoria de fase
+//   - reinicios de Luby
+//   - supuestos (assumptions) para resolver de forma incremental: las
+//     cláusulas aprendidas se conservan entre llamadas
+// No se borran cláusulas aprendidas; el presupuesto de conflictos por
+// llamada acota la memoria.
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class EstadoSAT { SAT, UNSAT, DESCONOCIDO };
+
+struct EstadisticasSAT {
+    long long decisiones = 0;
+    long long propagaciones = 0;
+    long long conflictos = 0;
+    long long reinicios = 0;
+    long long aprendidas = 0;
+};
+
+class SolverSAT {
+public:
+    // Crea una variable nueva y devuelve su índice (>= 1)
+    int nueva_variable();
+    int num_variables() const { return (int)asignacion.size(); }
+    int num_clausulas() const { return num_originales; }
+
+    /* Añade una cláusula (antes de resolver o entre llamadas).
+        Devuelve false si la fórmula ya es insatisfacible. */
+    bool anadir_clausula(std::vector<int> lits);
+
+    /* Resuelve con los supuestos dados (literales que se fijan a
+        cierto). UNSAT con supuestos no invalida el resolutor; UNSAT
+        sin supuestos sí. max_conflictos < 0: sin límite. */
+    EstadoSAT resolver(const std::vector<int>& supuestos = {}, long long max_conflictos = -1);
+
+    // Valor de la variable en el último modelo (tras SAT)
+    bool valor(int var) const { return modelo[var - 1] == 1; }
+
+    EstadisticasSAT stats;
+
+private:
+    // Literal interno: 2 * var + signo (var desde 0)
+    static int interno(int lit) { return lit > 0 ? 2 * (lit - 1) : 2 * (-lit - 1) + 1; }
+    static int var_de(int p) { return p >> 1; }
+
+    // Valor de un literal: 1 cierto, 0 falso, -1 sin asignar
+    int valor_lit(int p) const {
+        const int8_t a = asignacion[var_de(p)];
+        return a < 0 ? -1 : (a ^ (p & 1));
+    }
+    int nivel_actual() const { return (int)limites_traza.size(); }
+
+    void asignar(int p, int razon);
+    int propagar();                     // Índice de la cláusula en conflicto o -1
+    void analizar(int conflicto, std::vector<int>& aprendida, int& nivel_vuelta);
+    bool redundante(int p) const;
+    void retroceder(int nivel);
+    int elegir_literal();
+    EstadoSAT buscar(long long max_conflictos, const std::vector<int>& supuestos, long long& presupuesto);
+    void vigilar(int c);
+
+    // Actividades (VSIDS) y montículo de variables
+    void aumentar(int v);
+    void mont_insertar(int v);
+    void mont_subir(int i);
+    void mont_bajar(int i);
+    int mont_extraer();
+
+    bool ok = true;
+    int num_originales = 0;
+    std::vector<std::vector<int>> clausulas;
+    std::vector<std::vector<int>> vigilantes;   // Por literal interno: cláusulas que lo vigilan
+    std::vector<int8_t> asignacion;              // Por variable: -1, 0, 1
+    std::vector<int8_t> fase;                    // Último valor asignado
+    std::vector<int> nivel, razon;
+    std::vector<int> traza, limites_traza;
+    std::size_t cabeza = 0;                      // Siguiente literal de la traza a propagar
+    std::vector<char> visto;
+    std::vector<double> actividad;
+    double incremento = 1.0;
+    std::vector<int> monticulo, pos_monticulo;
+    std::vector<int8_t> modelo;
+};
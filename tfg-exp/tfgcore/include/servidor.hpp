@@ -0,0 +1,95 @@
+//----------------------------------------------------------------------
+// servidor.hpp
+//----------------------------------------------------------------------
+// Modo servidor: carga las instancias una vez, mantiene precalculados
+// los átomos y las tablas de candidatos de la exhaustiva, y atiende
+// peticiones por stdin o por un socket Unix con un pool de hilos.
+//----------------------------------------------------------------------
+//
+// Protocolo (una petición por línea, una respuesta JSON por línea):
+//
+//   SOLVE id=<id> [inst=<nombre>] [algo=exhaustiva|greedy|genetico] [k=3]
+//         [G=1,5,9 | G_seed=<s> G_size=<n>] [expr=0|1]
+//         [pop_size=<n>] [max_generations=<n>] [time_limit=<s>] [seed_expr=<s>]
+//   LOAD <nombre> <fichero>     carga una instancia binaria (ver instance_io.hpp)
+//   LIST                        instancias cargadas
+//   QUIT                        cierra la conexión (en stdin: termina)
+//   SHUTDOWN                    detiene el servidor
+//
+// Respuestas:
+//   {"id":"..","estado":"ok","algo":"..","tiempo_ms":..,"cota_jaccard":..,"frente":[..]}
+//   {"id":"..","estado":"error","mensaje":".."}
+//
+// Las peticiones SOLVE se resuelven en paralelo: las respuestas pueden
+// llegar en otro orden y se identifican por 'id'.
+//
+// Las tablas de la exhaustiva se quedan en memoria mientras viva la
+// instancia: una petición cuya tabla haría pasar las de su instancia de
+// max_bytes_tablas se rechaza (el tamaño crece muy deprisa con k).
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "atomos.hpp"
+#include "batch.hpp"
+#include "domain.hpp"
+#include "pool.hpp"
+#include "solutions.hpp"
+
+//------------------------------------------------------------------
+// Instancia residente en el servidor (F fija, G en cada petición)
+//------------------------------------------------------------------
+struct InstanciaServidor {
+    std::vector<Bitset> F;
+    Bitset U;                           // {0, ..., universo - 1}
+    int universo = U_size;
+    TablaAtomos atomos;                 // Precalculado al cargar
+    std::vector<SolMO> bloques_greedy;  // Bloques base (Jaccard sin puntuar),
+    std::vector<SolMO> bloques_ga;      // se copian y puntúan en cada petición
+
+    // Tablas de la exhaustiva por k, construidas en la primera petición
+    std::mutex m_tablas;
+    std::map<int, std::shared_ptr<const TablaCandidatos>> tablas;
+    std::uint64_t bytes_tablas = 0;     // Estimada (bytes_tabla_candidatos), incluidas las en curso
+};
+
+class Servidor {
+public:
+    explicit Servidor(int hilos = 0, std::uint64_t max_bytes_tablas = 1024ull << 20);
+
+    // Registra (o sustituye) una instancia de universo U y precalcula sus átomos y bloques base
+    void registrar_instancia(const std::string& nombre, std::vector<Bitset> F, const Bitset& U);
+
+    // Resuelve una línea SOLVE y devuelve la respuesta JSON (sin '\n')
+    std::string resolver(const std::string& linea);
+
+    // Atiende peticiones por stdin/stdout hasta EOF, QUIT o SHUTDOWN
+    void servir_stdin();
+
+    // Atiende peticiones en un socket Unix hasta SHUTDOWN (solo POSIX)
+    void servir_socket(const std::string& path);
+
+private:
+    struct Conexion;
+
+    // Procesa una línea; devuelve false si la conexión debe cerrarse
+    bool atender(const std::string& linea, const std::shared_ptr<Conexion>& con);
+
+    std::shared_ptr<InstanciaServidor> buscar(const std::string& nombre);
+    std::shared_ptr<const TablaCandidatos> tabla(InstanciaServidor& inst, int k);
+
+    PoolTrabajo pool_;
+    std::uint64_t max_bytes_tablas_;    // Memoria máxima de las tablas de una instancia
+    std::mutex m_instancias_;
+    std::map<std::string, std::shared_ptr<InstanciaServidor>> instancias_;
+    std::atomic<bool> parar_{false};
+    int fd_escucha_ = -1;
+};
@@ -0,0 +1,40 @@
+//----------------------------------------------------------------------
+// simplificacion.hpp
+//----------------------------------------------------------------------
+// Simplificación y forma canónica de expresiones.
+//----------------------------------------------------------------------
+//
+// Reescritura de abajo arriba sobre el árbol (arbol.hpp). En cada nodo
+// (A op B) se compara el conjunto resultante con:
+//   - ∅ y U                     ((X \ U), (X \ X), (X ∪ U), ...)
+//   - el de A o el de B         ((X ∪ X), ((A ∩ B) ∩ A), operandos
+//                                 que no aportan nada, ...)
+//   - el de un F_i usado en el subárbol
+// y se sustituye el nodo por el candidato con menos operaciones (y
+// después menos conjuntos). Las comparaciones son por bitset sobre la
+// instancia, así que el conjunto de la expresión no cambia nunca y
+// n_ops y |H| no aumentan.
+//
+// Forma canónica: en ∪ y ∩ los operandos se ordenan por su texto, de
+// modo que expresiones equivalentes por conmutatividad comparten
+// expr_str (sirve como clave de deduplicación).
+//----------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "domain.hpp"
+#include "expr.hpp"
+
+//------------------------------------------------------------------
+/* Simplifica 'e' y la deja en forma canónica (texto, used_sets y
+    n_ops). U solo cuenta en used_sets si ya contaba en 'e'. Devuelve
+    true si la expresión cambió. Las expresiones que no se pueden
+    analizar se dejan como están. */
+//------------------------------------------------------------------
+bool simplificar_expresion(Expression& e, const std::vector<Bitset>& F, const Bitset& U);
+
+// Forma canónica (simplificada) de expr_str, sin modificar la expresión
+std::string forma_canonica(const std::string& expr_str, const std::vector<Bitset>& F, const Bitset& U);
@@ -7,7 +7,9 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdio>
 #include <iostream>
+#include <string>
 #include <vector>
 
 #include "expr.hpp"
@@ -50,57 +52,68 @@ inline bool dominates(const SolMO& a, const SolMO& b) {
 }
 
 //------------------------------------------------------------------
-// Frente de Pareto genérico (SolMO / Individuo)
+/* Frente de Pareto genérico (SolMO / Individuo), también por partes:
+    anadir_no_dominada() procesa las soluciones de una en una en el
+    mismo orden y ordenar_frente() deja el orden final, para no tener
+    que guardar todas las candidatas. T necesita jaccard, sizeH, n_ops
+    y un dominates(T, T). */
 //------------------------------------------------------------------
 template<typename T>
-std::vector<T> pareto_front_generic(const std::vector<T>& v) {
-    // Caso trivial
-    if (v.empty()) return {};
+void anadir_no_dominada(std::vector<T>& nd, const T& sol) {
+    bool sol_is_dominated = false;
     
-    std::vector<T> nd; // El frente no dominado
-    nd.reserve(v.size() / 10 + 1); 
-
-    // Iterar sobre todas las soluciones
-    for (const auto& sol : v) {
-        bool sol_is_dominated = false;
+    // Comprobar si 'sol' es dominada por alguna del frente actual
+    size_t i = 0;
+    while (i < nd.size()) { // Bucle interno: O(M)
         
-        // Comprobar si 'sol' es dominada por alguna del frente actual
-        int i = 0;
-        while (i < nd.size()) { // Bucle interno: O(M)
+        const auto& other = nd[i];
+
+        // Comprobar dominancia entre 'sol' y 'other'
+        if (dominates(other, sol)) {
+            sol_is_dominated = true;
+            break;
+        }
+        // 'other' no domina a 'sol', comprobar si 'sol' domina a 'other'
+        if (dominates(sol, other)) {
+            nd[i] = nd.back();
+            nd.pop_back();
             
-            const auto& other = nd[i];
-
-            // Comprobar dominancia entre 'sol' y 'other'
-            if (dominates(other, sol)) {
-                sol_is_dominated = true;
-                break;
-            }
-            // 'other' no domina a 'sol', comprobar si 'sol' domina a 'other'
-            if (dominates(sol, other)) {
-                nd[i] = nd.back();
-                nd.pop_back();
-                
-            } 
-            // 'Ninguna dominancia', seguir con la siguiente
-            else {
-                i++;
-            }
+        } 
+        // 'Ninguna dominancia', seguir con la siguiente
+        else {
+            i++;
         }
+    }
 
-        // Si 'sol' no fue dominado por nadie del frente actual,
-        // entonces 'sol' pertenece al frente.
-        if (!sol_is_dominated) {
-            nd.push_back(sol);
-        }
+    // Si 'sol' no fue dominado por nadie del frente actual,
+    // entonces 'sol' pertenece al frente.
+    if (!sol_is_dominated) {
+        nd.push_back(sol);
     }
-    
-    // Ordenar el frente de Pareto resultante
+}
+
+// Ordenar el frente de Pareto resultante
+template<typename T>
+void ordenar_frente(std::vector<T>& nd) {
     std::stable_sort(nd.begin(), nd.end(), [](const T& a, const T& b) {
         if (a.jaccard != b.jaccard) return a.jaccard > b.jaccard; // descendente
         if (a.sizeH != b.sizeH) return a.sizeH < b.sizeH; // ascendente
         return a.n_ops < b.n_ops; // ascendente
     });
+}
+
+template<typename T>
+std::vector<T> pareto_front_generic(const std::vector<T>& v) {
+    // Caso trivial
+    if (v.empty()) return {};
+    
+    std::vector<T> nd; // El frente no dominado
+    nd.reserve(v.size() / 10 + 1); 
+
+    // Iterar sobre todas las soluciones
+    for (const auto& sol : v) anadir_no_dominada(nd, sol);
     
+    ordenar_frente(nd);
     return nd;
 }
 
@@ -117,22 +130,36 @@ inline std::vector<Individuo> pareto_front(const std::vector<Individuo>& v) {
     return pareto_front_generic(v);
 }
 
+//------------------------------------------------------------------
+// Texto de una solución del frente (mismo formato que std::cout)
+//------------------------------------------------------------------
+inline void anadir_solucion_texto(std::string& out, const SolMO& s, size_t i) {
+    char num[64];
+    out += "Solución ";
+    out += std::to_string(i + 1);
+    out += ":\n  Expresión: ";
+    out += s.expr.expr_str;
+    std::snprintf(num, sizeof(num), "\n  Jaccard: %g\n", s.jaccard);
+    out += num;
+    out += "  Operaciones: ";
+    out += std::to_string(s.n_ops);
+    out += "\n  |H|: ";
+    out += std::to_string(s.sizeH);
+    out += "\n\n";
+}
+
 //------------------------------------------------------------------
 // Impresión sencilla del frente de Pareto (general)
+// Se compone en memoria y se escribe de una vez (sin std::endl)
 //------------------------------------------------------------------
 template<typename T>
 void print_pareto_front_generic(const vector<T>& pareto) {
-    std::cout << "\n=== FRENTE DE PARETO ===" << std::endl;
-    std::cout << "Total soluciones no dominadas: " << pareto.size() << "\n" << std::endl;
-    
-    for (size_t i = 0; i < pareto.size(); i++) {
-        std::cout << "Solución " << (i+1) << ":" << std::endl;
-        std::cout << "  Expresión: " << pareto[i].expr.expr_str << std::endl;
-        std::cout << "  Jaccard: " << pareto[i].jaccard << std::endl;
-        std::cout << "  Operaciones: " << pareto[i].n_ops << std::endl;
-        std::cout << "  |H|: " << pareto[i].sizeH << std::endl;
-        std::cout << std::endl;
-    }
+    std::string out;
+    out.reserve(64 + pareto.size() * 96);
+    out += "\n=== FRENTE DE PARETO ===\n";
+    out += "Total soluciones no dominadas: " + std::to_string(pareto.size()) + "\n\n";
+    for (size_t i = 0; i < pareto.size(); i++) anadir_solucion_texto(out, pareto[i], i);
+    std::cout.write(out.data(), (std::streamsize)out.size());
 }
 
 // ------------------------------------------------------------------
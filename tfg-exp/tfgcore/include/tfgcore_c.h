@@ -0,0 +1,107 @@
+/*----------------------------------------------------------------------
+ * tfgcore_c.h
+ *----------------------------------------------------------------------
+ * API C estable de tfgcore para usar los algoritmos dentro del proceso
+ * (sin lanzar main ni parsear texto). Se enlaza con libtfgcore (.a/.so).
+ *
+ * Conjuntos empaquetados: el elemento i está en la palabra i/64, bit
+ * i%64 (mismo formato que los ficheros de instancia binarios). Cada
+ * conjunto ocupa tfg_palabras(universo) palabras de 64 bits.
+ *
+ * Las instancias se pueden usar desde varios hilos a la vez. Los
+ * frentes no: cada llamada a tfg_resolver devuelve uno nuevo.
+ *----------------------------------------------------------------------*/
+
+#ifndef TFGCORE_C_H
+#define TFGCORE_C_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#  if defined(TFGCORE_EXPORTAR)
+#    define TFG_API __declspec(dllexport)
+#  else
+#    define TFG_API
+#  endif
+#else
+#  define TFG_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TFG_API_VERSION 1
+
+typedef struct tfg_instancia tfg_instancia;
+typedef struct tfg_frente tfg_frente;
+
+typedef enum {
+    TFG_OK = 0,
+    TFG_ERROR_ARGUMENTO = 1,    /* Parámetros inválidos */
+    TFG_ERROR_FICHERO = 2,      /* Error de lectura */
+    TFG_ERROR_INTERNO = 3       /* Cualquier otro fallo */
+} tfg_estado;
+
+typedef enum {
+    TFG_GREEDY = 0,
+    TFG_EXHAUSTIVA = 1,
+    TFG_NSGA2 = 2
+} tfg_algoritmo;
+
+/* Parámetros de resolución (rellenar con tfg_parametros_defecto) */
+typedef struct {
+    int algoritmo;              /* tfg_algoritmo */
+    int k;                      /* Máximo de operaciones */
+    /* NSGA-II */
+    int pop_size;
+    int max_generations;
+    int time_limit_sec;         /* Presupuesto de tiempo */
+    double crossover_prob;
+    double mutation_prob;
+    int tournament_size;
+    uint64_t seed;              /* 0 => aleatoria */
+} tfg_parametros;
+
+/* Solución del frente: los punteros son válidos mientras viva el frente */
+typedef struct {
+    int n_ops;
+    int sizeH;
+    double jaccard;
+    const char* expr;           /* Terminada en '\0' */
+    size_t expr_len;
+} tfg_solucion;
+
+/* Versión de la API y tamaño máximo de universo compilado (U_SIZE) */
+TFG_API int tfg_version(void);
+TFG_API uint64_t tfg_u_size(void);
+TFG_API uint64_t tfg_palabras(uint64_t universo);
+
+/* Mensaje del último error en el hilo actual ("" si no hay) */
+TFG_API const char* tfg_ultimo_error(void);
+
+TFG_API void tfg_parametros_defecto(tfg_parametros* p);
+
+/* Instancias: F empaquetada (num_F x tfg_palabras(universo) palabras) */
+TFG_API tfg_estado tfg_instancia_crear(uint64_t universo, const uint64_t* F, uint32_t num_F,
+                                       tfg_instancia** out);
+TFG_API tfg_estado tfg_instancia_cargar(const char* path, tfg_instancia** out);
+TFG_API uint32_t tfg_instancia_num_conjuntos(const tfg_instancia* inst);
+TFG_API void tfg_instancia_liberar(tfg_instancia* inst);
+
+/* Resolución para un objetivo G empaquetado (tfg_palabras(universo) palabras) */
+TFG_API tfg_estado tfg_resolver(tfg_instancia* inst, const uint64_t* G,
+                                const tfg_parametros* p, tfg_frente** out);
+
+/* Recorrido del frente sin copias */
+TFG_API size_t tfg_frente_tam(const tfg_frente* f);
+TFG_API tfg_estado tfg_frente_solucion(const tfg_frente* f, size_t i, tfg_solucion* out);
+TFG_API long long tfg_frente_tiempo_ms(const tfg_frente* f);
+TFG_API void tfg_frente_liberar(tfg_frente* f);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TFGCORE_C_H */
@@ -0,0 +1,127 @@
+//----------------------------------------------------------------------
+// arbol.cpp
+//----------------------------------------------------------------------
+// Árbol de una expresión, reconstruido a partir de expr_str.
+//----------------------------------------------------------------------
+
+#include "arbol.hpp"
+
+#include <cctype>
+#include <cstring>
+#include <stdexcept>
+
+using namespace std;
+
+//------------------------------------------------------------------
+// Análisis descendente recursivo
+//------------------------------------------------------------------
+namespace {
+struct Analizador {
+    const string& s;
+    const vector<Bitset>& F;
+    const Bitset& U;
+    ArbolExpr& arbol;
+    size_t p = 0;
+
+    [[noreturn]] void error(const string& msg) const {
+        throw invalid_argument("Expresión inválida (posición " + to_string(p) + "): " + msg);
+    }
+
+    bool consumir(const char* t) {
+        size_t n = strlen(t);
+        if (s.compare(p, n, t) != 0) return false;
+        p += n;
+        return true;
+    }
+
+    int nodo() {
+        const int id = (int)arbol.nodos.size();
+        arbol.nodos.emplace_back();
+        if (consumir("(")) {
+            int izq = nodo();
+            int op = -1;
+            for (int o = 0; o < 3 && op < 0; o++) {
+                if (consumir(texto_op(o))) op = o;
+            }
+            if (op < 0) error("se esperaba una operación");
+            int der = nodo();
+            if (!consumir(")")) error("se esperaba ')'");
+            NodoExpr& n = arbol.nodos[id];
+            n.op = op;
+            n.izq = izq;
+            n.der = der;
+            arbol.nodos[izq].padre = id;
+            arbol.nodos[der].padre = id;
+            n.conjunto = apply_op(op, arbol.nodos[izq].conjunto, arbol.nodos[der].conjunto);
+            return id;
+        }
+        NodoExpr& n = arbol.nodos[id];
+        if (consumir("U")) {
+            n.hoja = HOJA_U;
+            n.conjunto = U;
+        } else if (consumir("∅")) {
+            n.hoja = HOJA_VACIA;
+        } else if (consumir("F")) {
+            size_t q = p;
+            int i = 0;
+            while (p < s.size() && isdigit((unsigned char)s[p])) i = i * 10 + (s[p++] - '0');
+            if (p == q) error("se esperaba el índice de F");
+            if (i >= (int)F.size()) error("F" + to_string(i) + " fuera de rango");
+            n.hoja = i;
+            n.conjunto = F[i];
+        } else {
+            error("se esperaba '(', 'F', 'U' o '∅'");
+        }
+        return id;
+    }
+};
+} // namespace
+
+ArbolExpr parsear_expresion(const string& expr_str, const vector<Bitset>& F, const Bitset& U) {
+    ArbolExpr arbol;
+    Analizador a{expr_str, F, U, arbol};
+    arbol.raiz = a.nodo();
+    if (a.p != expr_str.size()) a.error("texto sobrante");
+    return arbol;
+}
+
+//------------------------------------------------------------------
+// Utilidades
+//------------------------------------------------------------------
+void recalcular_camino(ArbolExpr& arbol, int nodo) {
+    for (int v = nodo; v >= 0; v = arbol.nodos[v].padre) {
+        NodoExpr& n = arbol.nodos[v];
+        if (n.op >= 0) n.conjunto = apply_op(n.op, arbol.nodos[n.izq].conjunto, arbol.nodos[n.der].conjunto);
+    }
+}
+
+static void anadir_texto(const ArbolExpr& arbol, int v, string& out) {
+    const NodoExpr& n = arbol.nodos[v];
+    if (n.op < 0) {
+        if (n.hoja == HOJA_U) out += "U";
+        else if (n.hoja == HOJA_VACIA) out += "∅";
+        else out += "F" + to_string(n.hoja);
+        return;
+    }
+    out += "(";
+    anadir_texto(arbol, n.izq, out);
+    out += texto_op(n.op);
+    anadir_texto(arbol, n.der, out);
+    out += ")";
+}
+
+string arbol_texto(const ArbolExpr& arbol, int nodo) {
+    string out;
+    anadir_texto(arbol, nodo < 0 ? arbol.raiz : nodo, out);
+    return out;
+}
+
+Expression arbol_a_expresion(const ArbolExpr& arbol) {
+    set<int> usados;
+    int n_ops = 0;
+    for (const auto& n : arbol.nodos) {
+        if (n.op >= 0) n_ops++;
+        else if (n.hoja != HOJA_VACIA) usados.insert(n.hoja);
+    }
+    return Expression(arbol.nodos[arbol.raiz].conjunto, arbol_texto(arbol), usados, n_ops);
+}
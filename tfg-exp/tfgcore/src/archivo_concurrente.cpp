@@ -0,0 +1,130 @@
+//----------------------------------------------------------------------
+// archivo_concurrente.cpp
+//----------------------------------------------------------------------
+// Archivo de soluciones por celdas (n_ops, |H|) sin cerrojos.
+//----------------------------------------------------------------------
+
+#include "archivo_concurrente.hpp"
+
+#include <stdexcept>
+
+using namespace std;
+
+ArchivoConcurrente::ArchivoConcurrente(int max_ops, int max_sizeH, bool solo_no_dominadas)
+    : max_ops_(max_ops), max_sizeH_(max_sizeH), solo_no_dominadas_(solo_no_dominadas) {
+    if (max_ops < 0 || max_sizeH < 0) throw invalid_argument("max_ops y max_sizeH deben ser >= 0");
+    num_celdas_ = (max_ops + 1) * (max_sizeH + 1);
+    celdas_.reset(new atomic<Entrada*>[num_celdas_]);
+    for (int c = 0; c < num_celdas_; c++) celdas_[c].store(nullptr, memory_order_relaxed);
+}
+
+ArchivoConcurrente::~ArchivoConcurrente() {
+    recoger();
+    for (int c = 0; c < num_celdas_; c++) delete celdas_[c].load(memory_order_relaxed);
+}
+
+//------------------------------------------------------------------
+// Inserción
+//------------------------------------------------------------------
+// Alguna celda (o' <= o, h' <= h) distinta con Jaccard >= domina a ind
+bool ArchivoConcurrente::dominada_por_otra(const Individuo& ind) const {
+    for (int o = 0; o <= ind.n_ops; o++) {
+        for (int h = 0; h <= ind.sizeH; h++) {
+            if (o == ind.n_ops && h == ind.sizeH) continue;
+            const Entrada* e = celdas_[celda(o, h)].load(memory_order_acquire);
+            if (e && e->ind.jaccard >= ind.jaccard) return true;
+        }
+    }
+    return false;
+}
+
+void ArchivoConcurrente::retirar(Entrada* e) {
+    Entrada* cabeza = retiradas_.load(memory_order_relaxed);
+    do {
+        e->siguiente_retirada = cabeza;
+    } while (!retiradas_.compare_exchange_weak(cabeza, e, memory_order_release, memory_order_relaxed));
+}
+
+bool ArchivoConcurrente::insertar(const Individuo& ind) {
+    candidatas_.fetch_add(1, memory_order_relaxed);
+    if (ind.n_ops < 0 || ind.n_ops > max_ops_ || ind.sizeH < 0 || ind.sizeH > max_sizeH_) return false;
+
+    // Camino rápido: solo lecturas, sin reservar memoria
+    if (solo_no_dominadas_ && dominada_por_otra(ind)) {
+        rechazo_rapido_.fetch_add(1, memory_order_relaxed);
+        return false;
+    }
+    atomic<Entrada*>& c = celdas_[celda(ind.n_ops, ind.sizeH)];
+    Entrada* actual = c.load(memory_order_acquire);
+    if (actual && !preferida_en_celda(ind, actual->ind)) {
+        rechazo_celda_.fetch_add(1, memory_order_relaxed);
+        return false;
+    }
+
+    Entrada* nueva = new Entrada{ind, nullptr};
+    nueva->ind.rank = 0;
+    nueva->ind.crowd = 0.0;
+    while (!c.compare_exchange_weak(actual, nueva, memory_order_acq_rel, memory_order_acquire)) {
+        // Otro hilo cambió la celda: comparar con la nueva entrada
+        reintentos_.fetch_add(1, memory_order_relaxed);
+        if (actual && !preferida_en_celda(ind, actual->ind)) {
+            delete nueva;
+            rechazo_celda_.fetch_add(1, memory_order_relaxed);
+            return false;
+        }
+    }
+    if (actual) retirar(actual);
+    insertadas_.fetch_add(1, memory_order_relaxed);
+    return true;
+}
+
+void ArchivoConcurrente::recoger() {
+    Entrada* e = retiradas_.exchange(nullptr, memory_order_acquire);
+    while (e) {
+        Entrada* sig = e->siguiente_retirada;
+        delete e;
+        e = sig;
+    }
+}
+
+//------------------------------------------------------------------
+// Lectura
+//------------------------------------------------------------------
+bool ArchivoConcurrente::leer(int celda, Individuo& out) const {
+    if (celda < 0 || celda >= num_celdas_) return false;
+    const Entrada* e = celdas_[celda].load(memory_order_acquire);
+    if (!e) return false;
+    out = e->ind;
+    return true;
+}
+
+vector<Individuo> ArchivoConcurrente::elites() const {
+    vector<Individuo> r;
+    Individuo ind;
+    for (int c = 0; c < num_celdas_; c++) {
+        if (leer(c, ind)) r.push_back(ind);
+    }
+    return r;
+}
+
+vector<SolMO> ArchivoConcurrente::frente() const {
+    vector<SolMO> v;
+    for (const auto& ind : elites()) v.push_back(ind);
+    return pareto_front(v);
+}
+
+int ArchivoConcurrente::num_ocupadas() const {
+    int n = 0;
+    for (int c = 0; c < num_celdas_; c++) n += celdas_[c].load(memory_order_acquire) != nullptr;
+    return n;
+}
+
+ArchivoConcurrente::Estadisticas ArchivoConcurrente::estadisticas() const {
+    Estadisticas s;
+    s.candidatas = candidatas_.load(memory_order_relaxed);
+    s.rechazo_rapido = rechazo_rapido_.load(memory_order_relaxed);
+    s.rechazo_celda = rechazo_celda_.load(memory_order_relaxed);
+    s.insertadas = insertadas_.load(memory_order_relaxed);
+    s.reintentos = reintentos_.load(memory_order_relaxed);
+    return s;
+}
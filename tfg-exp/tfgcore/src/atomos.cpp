@@ -0,0 +1,79 @@
+//----------------------------------------------------------------------
+// atomos.cpp
+//----------------------------------------------------------------------
+// Átomos de una familia F y cota superior del Jaccard.
+//----------------------------------------------------------------------
+
+#include "atomos.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+using namespace std;
+
+//------------------------------------------------------------------
+// Construcción por refinamiento: cada F_i parte los átomos actuales
+// en (A ∩ F_i) y (A \ F_i)
+//------------------------------------------------------------------
+TablaAtomos construir_atomos(const vector<Bitset>& F, const Bitset& U) {
+    TablaAtomos t;
+    t.atomo.assign(U_size, -1);
+    int num = 0;
+    for (int i = 0; i < U_size; i++) {
+        if (U[i]) {
+            t.atomo[i] = 0;
+            num = 1;
+        }
+    }
+
+    for (const auto& Fi : F) {
+        // (átomo anterior, pertenece a F_i) -> átomo nuevo
+        unordered_map<long long, int> nuevo;
+        nuevo.reserve((size_t)num * 2);
+        for (int i = 0; i < U_size; i++) {
+            if (t.atomo[i] < 0) continue;
+            long long clave = 2LL * t.atomo[i] + (Fi[i] ? 1 : 0);
+            auto it = nuevo.emplace(clave, (int)nuevo.size()).first;
+            t.atomo[i] = it->second;
+        }
+        num = (int)nuevo.size();
+    }
+
+    t.tam.assign(num, 0);
+    for (int a : t.atomo) {
+        if (a >= 0) t.tam[a]++;
+    }
+    return t;
+}
+
+//------------------------------------------------------------------
+// Cota superior del Jaccard
+//------------------------------------------------------------------
+double cota_jaccard(const TablaAtomos& t, const Bitset& G) {
+    // G vacío: la unión vacía de átomos da J(∅, ∅) = 1 (como M())
+    const int card_G = (int)G.count();
+    if (card_G == 0) return 1.0;
+
+    // |A ∩ G| por átomo (los elementos de G fuera de U no son alcanzables)
+    vector<int> inter(t.tam.size(), 0);
+    for (int i = 0; i < U_size; i++) {
+        if (G[i] && t.atomo[i] >= 0) inter[t.atomo[i]]++;
+    }
+
+    vector<int> orden;
+    for (int a = 0; a < (int)t.tam.size(); a++) {
+        if (inter[a] > 0) orden.push_back(a);
+    }
+    sort(orden.begin(), orden.end(), [&](int a, int b) {
+        return (long long)inter[a] * t.tam[b] > (long long)inter[b] * t.tam[a];
+    });
+
+    double mejor = 0.0;
+    long long I = 0, S = 0;
+    for (int a : orden) {
+        I += inter[a];
+        S += t.tam[a];
+        mejor = max(mejor, (double)I / (double)(card_G + S - I));
+    }
+    return mejor;
+}
@@ -0,0 +1,232 @@
+//----------------------------------------------------------------------
+// batch.cpp
+//----------------------------------------------------------------------
+// Resolución por lotes: una familia F y muchos conjuntos objetivo G.
+// Las combinaciones de conjuntos se calculan una sola vez y se evalúan
+// contra todos los objetivos.
+//----------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "batch.hpp"
+#include "metrics.hpp"
+#include "solutions.hpp"
+
+using namespace std;
+
+// Candidatas por tanda de filas del nivel que no se guarda
+static constexpr size_t CANDIDATAS_POR_TANDA = 1 << 16;
+
+//------------------------------------------------------------------
+// Composición de conjuntos y máscaras (sin evaluar)
+//------------------------------------------------------------------
+/* Filas [fila0, fila1) de izq x toda la derecha; el par (i, j) va a la
+    posición base + (i - fila0) * |der| + j de destino. */
+template <int OP>
+static void componer_filas(const NivelSoA& izq, size_t fila0, size_t fila1, const NivelSoA& der,
+                           NivelSoA& destino, size_t base) {
+    const size_t n_der = der.size();
+    const int P = izq.palabras;
+    const size_t bloque = columnas_por_bloque(P);
+    for (size_t j0 = 0; j0 < n_der; j0 += bloque) {
+        const size_t j1 = min(n_der, j0 + bloque);
+        for (size_t i = fila0; i < fila1; i++) {
+            const Bitset& A = izq.conjuntos[i];
+            const uint64_t* mA = izq.mascara(i);
+            for (size_t j = j0; j < j1; j++) {
+                const size_t d = base + (i - fila0) * n_der + j;
+                destino.conjuntos[d] = aplicar_op_fija<OP>(A, der.conjuntos[j]);
+                const uint64_t* mB = der.mascara(j);
+                uint64_t* m = destino.mascaras.data() + d * P;
+                for (int w = 0; w < P; w++) m[w] = mA[w] | mB[w];
+            }
+        }
+    }
+}
+
+static void componer_filas_op(int op, const NivelSoA& izq, size_t fila0, size_t fila1, const NivelSoA& der,
+                              NivelSoA& destino, size_t base) {
+    if (op == 0) componer_filas<0>(izq, fila0, fila1, der, destino, base);
+    else if (op == 1) componer_filas<1>(izq, fila0, fila1, der, destino, base);
+    else componer_filas<2>(izq, fila0, fila1, der, destino, base);
+}
+
+//------------------------------------------------------------------
+/* Niveles 0..guardados y bloques de todos los niveles hasta k (mismo
+    orden que exhaustive_search). Los niveles por encima de 'guardados'
+    se recorren por tandas al evaluar. */
+//------------------------------------------------------------------
+static TablaCandidatos construir_niveles(const vector<Bitset>& F, const Bitset& U, int k, int guardados) {
+    TablaCandidatos tabla;
+    tabla.k = k;
+    tabla.num_conjuntos = (int)F.size();
+    tabla.niveles.resize(guardados + 1);
+    tabla.bloques.resize(k + 1);
+    auto& niveles = tabla.niveles;
+
+    // Nivel 0: conjunto universo + conjuntos base
+    niveles[0] = nivel_base(F, U);
+
+    // Generar expresiones con s operaciones (1...k)
+    for (int s = 1; s <= k; s++) {
+        size_t total = 0;
+        for (int op = 0; op < 3; op++) {
+            for (int a = 0; a < s; a++) {
+                const int b = s - a - 1;
+                tabla.bloques[s].push_back({op, a, b, total});
+                total += niveles[a].size() * niveles[b].size();
+            }
+        }
+        if (s > guardados) continue;
+
+        niveles[s].palabras = niveles[0].palabras;
+        niveles[s].redimensionar(total);
+        for (const BloqueNivel& bl : tabla.bloques[s]) {
+            componer_filas_op(bl.op, niveles[bl.a], 0, niveles[bl.a].size(), niveles[bl.b],
+                              niveles[s], bl.base);
+        }
+    }
+    return tabla;
+}
+
+TablaCandidatos construir_tabla_candidatos(
+    const vector<Bitset>& F,
+    const Bitset& U,
+    int k)
+{
+    return construir_niveles(F, U, k, k);
+}
+
+uint64_t bytes_tabla_candidatos(size_t num_F, int k) {
+    // |nivel s| = 3 * sum_a |nivel a| * |nivel s - 1 - a| (en double: puede desbordar)
+    vector<double> tam(max(k, 0) + 1);
+    tam[0] = (double)num_F + 1;
+    double total = tam[0];
+    for (int s = 1; s <= k; s++) {
+        tam[s] = 0.0;
+        for (int a = 0; a < s; a++) tam[s] += 3.0 * tam[a] * tam[s - 1 - a];
+        total += tam[s];
+    }
+    const double bytes = total * (sizeof(Bitset) + 8.0 * palabras_mascara(num_F));
+    return bytes >= 1.8e19 ? UINT64_MAX : (uint64_t)bytes;
+}
+
+//------------------------------------------------------------------
+/* Evalúa la tabla contra todos los objetivos.
+    Para cada objetivo y cada celda (n_ops, |H|) solo se guardan las
+    expresiones con el mejor Jaccard de la celda (empates incluidos):
+    cualquier otra está dominada por ellas, así que el frente final es
+    el mismo que filtrando todas las candidatas. Las expresiones se
+    rehacen solo para los frentes. */
+//------------------------------------------------------------------
+vector<vector<SolMO>> evaluar_objetivos(
+    const TablaCandidatos& tabla,
+    const vector<Bitset>& Gs)
+{
+    const size_t T = Gs.size();
+    if (T == 0) return {};
+
+    // Cardinales de los objetivos (se calculan una vez)
+    vector<int> card_G(T);
+    for (size_t t = 0; t < T; t++) card_G[t] = Gs[t].count();
+
+    // Celdas (n_ops, |H|) por objetivo
+    const int ancho = tabla.num_conjuntos + 1;
+    const size_t n_celdas = (size_t)(tabla.k + 1) * ancho;
+    vector<double> mejor(T * n_celdas, -1.0);
+    vector<vector<pair<int, size_t>>> ganadores(T * n_celdas);
+
+    // Evaluar cada candidata una sola vez contra todos los objetivos
+    const int P = tabla.niveles[0].palabras;
+    vector<double> j(T);
+    auto evaluar = [&](int s, size_t idx, const Bitset& H, const uint64_t* mascara) {
+        jaccard_lote(H, Gs, card_G, j.data());
+        int sizeH = 0;
+        for (int w = 0; w < P; w++) sizeH += __builtin_popcountll(mascara[w]);
+
+        const size_t celda = (size_t)s * ancho + sizeH;
+        for (size_t t = 0; t < T; t++) {
+            const size_t c = t * n_celdas + celda;
+            if (j[t] > mejor[c]) {
+                mejor[c] = j[t];
+                ganadores[c].clear();
+                ganadores[c].emplace_back(s, idx);
+            } else if (j[t] == mejor[c]) {
+                ganadores[c].emplace_back(s, idx);
+            }
+        }
+    };
+
+    NivelSoA tanda;
+    tanda.palabras = P;
+    for (int s = 0; s <= tabla.k; s++) {
+        if (s < (int)tabla.niveles.size()) {
+            const NivelSoA& nivel = tabla.niveles[s];
+            for (size_t idx = 0; idx < nivel.size(); idx++) evaluar(s, idx, nivel.conjuntos[idx], nivel.mascara(idx));
+            continue;
+        }
+        // Nivel no guardado: se compone por tandas de filas
+        for (const BloqueNivel& bl : tabla.bloques[s]) {
+            const NivelSoA& izq = tabla.niveles[bl.a];
+            const NivelSoA& der = tabla.niveles[bl.b];
+            if (der.size() == 0) continue;
+            const size_t filas = max<size_t>(1, CANDIDATAS_POR_TANDA / der.size());
+            for (size_t f0 = 0; f0 < izq.size(); f0 += filas) {
+                const size_t f1 = min(izq.size(), f0 + filas);
+                tanda.redimensionar((f1 - f0) * der.size());
+                componer_filas_op(bl.op, izq, f0, f1, der, tanda, 0);
+                const size_t base = bl.base + f0 * der.size();
+                for (size_t i = 0; i < tanda.size(); i++) evaluar(s, base + i, tanda.conjuntos[i], tanda.mascara(i));
+            }
+        }
+    }
+
+    // Frente de Pareto por objetivo a partir de los ganadores de cada celda
+    vector<vector<SolMO>> frentes(T);
+    vector<CandidataNivel> refs, frente;
+    for (size_t t = 0; t < T; t++) {
+        refs.clear();
+        for (size_t c = 0; c < n_celdas; c++) {
+            for (const auto& g : ganadores[t * n_celdas + c]) {
+                CandidataNivel cand;
+                cand.jaccard = mejor[t * n_celdas + c];
+                cand.n_ops = g.first;
+                cand.sizeH = (int)(c % ancho);
+                cand.indice = g.second;
+                refs.push_back(cand);
+            }
+        }
+        // Mantener el orden de generación (como exhaustive_search)
+        sort(refs.begin(), refs.end(), [](const CandidataNivel& a, const CandidataNivel& b) {
+            return a.n_ops != b.n_ops ? a.n_ops < b.n_ops : a.indice < b.indice;
+        });
+
+        frente.clear();
+        for (const auto& c : refs) anadir_no_dominada(frente, c);
+        ordenar_frente(frente);
+
+        frentes[t].reserve(frente.size());
+        for (const auto& c : frente) {
+            frentes[t].emplace_back(rehacer_expresion(tabla.niveles, tabla.bloques, c.n_ops, c.indice),
+                                    c.n_ops, c.sizeH, c.jaccard);
+        }
+    }
+    return frentes;
+}
+
+//------------------------------------------------------------------
+/* Búsqueda exhaustiva por lotes (tabla + evaluación). El nivel k no se
+    guarda: solo se combina una vez, así que se evalúa por tandas. */
+//------------------------------------------------------------------
+vector<vector<SolMO>> batch_exhaustive_search(
+    const vector<Bitset>& F,
+    const Bitset& U,
+    const vector<Bitset>& Gs,
+    int k)
+{
+    TablaCandidatos tabla = construir_niveles(F, U, k, max(k - 1, 0));
+    return evaluar_objetivos(tabla, Gs);
+}
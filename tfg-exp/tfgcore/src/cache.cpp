@@ -0,0 +1,239 @@
+//----------------------------------------------------------------------
+// cache.cpp
+//----------------------------------------------------------------------
+// Caché persistente de soluciones en disco.
+//----------------------------------------------------------------------
+
+#include "cache.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <thread>
+
+#include "instance_io.hpp"
+
+using namespace std;
+namespace fs = std::filesystem;
+
+static const char CACHE_MAGIC[8] = {'T', 'F', 'G', 'C', 'A', 'C', 'H', '1'};
+
+//------------------------------------------------------------------
+// Huella FNV-1a
+//------------------------------------------------------------------
+struct Fnv {
+    uint64_t h = 1469598103934665603ull;
+    void bytes(const void* p, size_t n) {
+        const unsigned char* b = static_cast<const unsigned char*>(p);
+        for (size_t i = 0; i < n; i++) {
+            h ^= b[i];
+            h *= 1099511628211ull;
+        }
+    }
+    template<typename V> void valor(const V& v) { bytes(&v, sizeof(v)); }
+    void texto(const string& s) {
+        valor<uint64_t>(s.size());
+        bytes(s.data(), s.size());
+    }
+    void conjunto(const Bitset& b) {
+        auto w = bitset_a_palabras(b);
+        bytes(w.data(), w.size() * sizeof(uint64_t));
+    }
+};
+
+uint64_t clave_cache(const vector<Bitset>& F, const Bitset& U, const Bitset& G,
+                     const string& algoritmo, int k, const GAParams* ga) {
+    Fnv f;
+    f.valor<uint64_t>(U_size);
+    f.conjunto(U);
+    f.conjunto(G);
+    f.valor<uint64_t>(F.size());
+    for (const auto& Fi : F) f.conjunto(Fi);
+    f.texto(algoritmo);
+    f.valor<int32_t>(k);
+    if (ga) {
+        f.valor<int32_t>(ga->population_size);
+        f.valor<int32_t>(ga->max_generations);
+        f.valor<int32_t>(ga->time_limit_sec);
+        f.valor<double>(ga->crossover_prob);
+        f.valor<double>(ga->mutation_prob);
+        f.valor<int32_t>(ga->tournament_size);
+        f.valor<uint64_t>(ga->seed);
+        // Solo si no es el valor por defecto: las entradas anteriores siguen valiendo
+        if (ga->max_reintentos != GAParams{}.max_reintentos) f.valor<int32_t>(ga->max_reintentos);
+        if (ga->simplificar) f.texto("simplificar");
+        if (ga->seleccion_hv) f.texto("seleccion_hv");
+        if (ga->memetica_frac > 0.0) {
+            f.valor<double>(ga->memetica_frac);
+            f.valor<int32_t>(ga->memetica_pasos);
+        }
+    }
+    return f.h;
+}
+
+static fs::path ruta_entrada(const CacheSoluciones& cache, uint64_t clave) {
+    char nombre[32];
+    snprintf(nombre, sizeof(nombre), "%016llx.frente", (unsigned long long)clave);
+    return fs::path(cache.dir) / nombre;
+}
+
+//------------------------------------------------------------------
+// Lectura
+//------------------------------------------------------------------
+template<typename V>
+static bool leer_valor(const string& buf, size_t& pos, V& v) {
+    if (pos + sizeof(V) > buf.size()) return false;
+    memcpy(&v, buf.data() + pos, sizeof(V));
+    pos += sizeof(V);
+    return true;
+}
+
+bool cache_buscar(const CacheSoluciones& cache, uint64_t clave, EntradaCache& out) {
+    const fs::path ruta = ruta_entrada(cache, clave);
+    ifstream in(ruta, ios::binary);
+    if (!in) return false;
+    string buf((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+
+    size_t pos = 8;
+    uint64_t clave_fichero = 0, u_size = 0;
+    int64_t tiempo = 0;
+    uint32_t n = 0;
+    if (buf.size() < 8 || memcmp(buf.data(), CACHE_MAGIC, 8) != 0) return false;
+    if (!leer_valor(buf, pos, clave_fichero) || clave_fichero != clave) return false;
+    if (!leer_valor(buf, pos, u_size) || u_size != cache.universo || u_size > (uint64_t)U_size) return false;
+    if (!leer_valor(buf, pos, tiempo) || !leer_valor(buf, pos, n)) return false;
+
+    const size_t wpc = palabras_para(u_size);
+    vector<SolMO> frente;
+    frente.reserve(n);
+    for (uint32_t i = 0; i < n; i++) {
+        int32_t n_ops, sizeH;
+        double jaccard;
+        uint32_t len, num_usados;
+        if (!leer_valor(buf, pos, n_ops) || !leer_valor(buf, pos, sizeH) ||
+            !leer_valor(buf, pos, jaccard) || !leer_valor(buf, pos, len) || pos + len > buf.size()) {
+            return false;
+        }
+        Expression e;
+        e.expr_str.assign(buf.data() + pos, len);
+        pos += len;
+        if (!leer_valor(buf, pos, num_usados)) return false;
+        for (uint32_t u = 0; u < num_usados; u++) {
+            int32_t v;
+            if (!leer_valor(buf, pos, v)) return false;
+            e.used_sets.insert(v);
+        }
+        if (pos + wpc * sizeof(uint64_t) > buf.size()) return false;
+        vector<uint64_t> w(wpc);
+        memcpy(w.data(), buf.data() + pos, wpc * sizeof(uint64_t));
+        pos += wpc * sizeof(uint64_t);
+        e.conjunto = palabras_a_bitset(w.data(), u_size);
+        e.n_ops = n_ops;
+        frente.emplace_back(e, n_ops, sizeH, jaccard);
+    }
+    if (pos != buf.size()) return false;
+
+    out.frente = move(frente);
+    out.tiempo_ms = tiempo;
+
+    // Acierto: la entrada pasa a ser la más reciente para el desalojo
+    error_code ec;
+    fs::last_write_time(ruta, fs::file_time_type::clock::now(), ec);
+    return true;
+}
+
+//------------------------------------------------------------------
+// Escritura y desalojo
+//------------------------------------------------------------------
+template<typename V>
+static void escribir_valor(string& buf, V v) {
+    buf.append(reinterpret_cast<const char*>(&v), sizeof(v));
+}
+
+// Borra las entradas más antiguas hasta quedar por debajo de max_bytes
+static void desalojar(const CacheSoluciones& cache) {
+    error_code ec;
+    vector<pair<fs::file_time_type, fs::path>> entradas;
+    vector<uint64_t> tams;
+    uint64_t total = 0;
+    const auto hace_una_hora = fs::file_time_type::clock::now() - chrono::hours(1);
+    for (const auto& d : fs::directory_iterator(cache.dir, ec)) {
+        // Temporales abandonados por procesos que terminaron a medias
+        if (d.path().filename().string().find(".tmp.") != string::npos) {
+            auto t = d.last_write_time(ec);
+            if (!ec && t < hace_una_hora) fs::remove(d.path(), ec);
+            continue;
+        }
+        if (d.path().extension() != ".frente") continue;
+        uint64_t tam = d.file_size(ec);
+        if (ec) continue;
+        auto t = d.last_write_time(ec);
+        if (ec) continue;
+        entradas.emplace_back(t, d.path());
+        tams.push_back(tam);
+        total += tam;
+    }
+    if (total <= cache.max_bytes) return;
+
+    vector<size_t> orden(entradas.size());
+    for (size_t i = 0; i < orden.size(); i++) orden[i] = i;
+    sort(orden.begin(), orden.end(), [&](size_t a, size_t b) { return entradas[a].first < entradas[b].first; });
+    for (size_t i : orden) {
+        if (total <= cache.max_bytes) break;
+        // Otro proceso puede haberla borrado ya: se ignora el error
+        if (fs::remove(entradas[i].second, ec)) total -= tams[i];
+    }
+}
+
+void cache_guardar(const CacheSoluciones& cache, uint64_t clave, const EntradaCache& entrada) {
+    string buf;
+    buf.append(CACHE_MAGIC, 8);
+    escribir_valor<uint64_t>(buf, clave);
+    escribir_valor<uint64_t>(buf, cache.universo);
+    escribir_valor<int64_t>(buf, entrada.tiempo_ms);
+    escribir_valor<uint32_t>(buf, (uint32_t)entrada.frente.size());
+    for (const auto& s : entrada.frente) {
+        escribir_valor<int32_t>(buf, s.n_ops);
+        escribir_valor<int32_t>(buf, s.sizeH);
+        escribir_valor<double>(buf, s.jaccard);
+        escribir_valor<uint32_t>(buf, (uint32_t)s.expr.expr_str.size());
+        buf += s.expr.expr_str;
+        escribir_valor<uint32_t>(buf, (uint32_t)s.expr.used_sets.size());
+        for (int u : s.expr.used_sets) escribir_valor<int32_t>(buf, u);
+        auto w = bitset_a_palabras(s.expr.conjunto, cache.universo);
+        buf.append(reinterpret_cast<const char*>(w.data()), w.size() * sizeof(uint64_t));
+    }
+
+    error_code ec;
+    fs::create_directories(cache.dir, ec);
+
+    // Nombre temporal único por proceso e hilo; rename publica la entrada
+    static atomic<uint64_t> contador{0};
+    random_device rd;
+    ostringstream tmp_nombre;
+    tmp_nombre << ".tmp." << hex << rd() << "." << hash<thread::id>()(this_thread::get_id())
+               << "." << contador++;
+    const fs::path final_path = ruta_entrada(cache, clave);
+    const fs::path tmp = final_path.string() + tmp_nombre.str();
+    {
+        ofstream out(tmp, ios::binary | ios::trunc);
+        if (!out) return;   // La caché es opcional: sin permisos, se ignora
+        out.write(buf.data(), (streamsize)buf.size());
+        if (!out) {
+            out.close();
+            fs::remove(tmp, ec);
+            return;
+        }
+    }
+    fs::rename(tmp, final_path, ec);
+    if (ec) {
+        fs::remove(tmp, ec);
+        return;
+    }
+    desalojar(cache);
+}
@@ -0,0 +1,383 @@
+//----------------------------------------------------------------------
+// comprimido.cpp
+//----------------------------------------------------------------------
+// Contenedores Roaring: Array, Mapa y Rachas, y operaciones entre ellos.
+//----------------------------------------------------------------------
+
+#include "comprimido.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+using namespace std;
+
+namespace {
+
+constexpr uint32_t MAX_ARRAY = 4096;    // Por encima, el Array ocupa más que el Mapa
+constexpr size_t PALABRAS = BLOQUE_ROARING / 64;
+
+// Racha [inicio, fin)
+struct Racha {
+    uint32_t inicio;
+    uint32_t fin;
+    bool operator==(const Racha& o) const { return inicio == o.inicio && fin == o.fin; }
+};
+
+//------------------------------------------------------------------
+// Mapa de bits
+//------------------------------------------------------------------
+inline bool bit(const vector<uint64_t>& m, uint32_t x) { return (m[x >> 6] >> (x & 63)) & 1u; }
+
+// Primer x >= desde con bit == valor (BLOQUE_ROARING si no hay)
+uint32_t buscar_bit(const vector<uint64_t>& m, uint32_t desde, bool valor) {
+    if (desde >= BLOQUE_ROARING) return BLOQUE_ROARING;
+    size_t w = desde >> 6;
+    uint64_t palabra = (valor ? m[w] : ~m[w]) & (~0ull << (desde & 63));
+    while (true) {
+        if (palabra) return (uint32_t)(w * 64 + __builtin_ctzll(palabra));
+        if (++w == PALABRAS) return BLOQUE_ROARING;
+        palabra = valor ? m[w] : ~m[w];
+    }
+}
+
+void poner_rango(vector<uint64_t>& m, uint32_t inicio, uint32_t fin) {
+    for (uint32_t x = inicio; x < fin;) {
+        const uint32_t w = x >> 6, desde = x & 63;
+        const uint32_t hasta = min<uint32_t>(64, desde + (fin - x));
+        const uint64_t mascara = (hasta == 64 ? ~0ull : ((1ull << hasta) - 1)) & (~0ull << desde);
+        m[w] |= mascara;
+        x += hasta - desde;
+    }
+}
+
+//------------------------------------------------------------------
+// Conversiones
+//------------------------------------------------------------------
+vector<Racha> a_rachas(const ContenedorRoaring& c) {
+    vector<Racha> r;
+    if (c.tipo == ContenedorRoaring::Rachas) {
+        r.reserve(c.valores.size() / 2);
+        for (size_t i = 0; i < c.valores.size(); i += 2) {
+            r.push_back({c.valores[i], (uint32_t)c.valores[i] + c.valores[i + 1] + 1});
+        }
+    } else if (c.tipo == ContenedorRoaring::Array) {
+        for (uint16_t x : c.valores) {
+            if (!r.empty() && r.back().fin == x) r.back().fin++;
+            else r.push_back({x, (uint32_t)x + 1});
+        }
+    } else {
+        uint32_t x = buscar_bit(c.mapa, 0, true);
+        while (x < BLOQUE_ROARING) {
+            const uint32_t fin = buscar_bit(c.mapa, x, false);
+            r.push_back({x, fin});
+            x = buscar_bit(c.mapa, fin, true);
+        }
+    }
+    return r;
+}
+
+vector<uint64_t> a_mapa(const ContenedorRoaring& c) {
+    if (c.tipo == ContenedorRoaring::Mapa) return c.mapa;
+    vector<uint64_t> m(PALABRAS, 0);
+    if (c.tipo == ContenedorRoaring::Array) {
+        for (uint16_t x : c.valores) m[x >> 6] |= 1ull << (x & 63);
+    } else {
+        for (const Racha& r : a_rachas(c)) poner_rango(m, r.inicio, r.fin);
+    }
+    return m;
+}
+
+vector<uint16_t> a_array(const ContenedorRoaring& c) {
+    if (c.tipo == ContenedorRoaring::Array) return c.valores;
+    vector<uint16_t> v;
+    v.reserve(c.card);
+    if (c.tipo == ContenedorRoaring::Mapa) {
+        for (uint32_t x = buscar_bit(c.mapa, 0, true); x < BLOQUE_ROARING; x = buscar_bit(c.mapa, x + 1, true)) {
+            v.push_back((uint16_t)x);
+        }
+    } else {
+        for (const Racha& r : a_rachas(c)) {
+            for (uint32_t x = r.inicio; x < r.fin; x++) v.push_back((uint16_t)x);
+        }
+    }
+    return v;
+}
+
+//------------------------------------------------------------------
+// Construcción con el contenedor más pequeño
+//------------------------------------------------------------------
+bool rachas_mas_pequeno(size_t num_rachas, uint32_t card) {
+    const size_t bytes_rachas = 4 * num_rachas;
+    const size_t bytes_otro = card <= MAX_ARRAY ? 2 * (size_t)card : 8 * PALABRAS;
+    return bytes_rachas < bytes_otro;
+}
+
+ContenedorRoaring con_rachas(uint16_t clave, const vector<Racha>& rachas, uint32_t card) {
+    ContenedorRoaring c;
+    c.clave = clave;
+    c.tipo = ContenedorRoaring::Rachas;
+    c.card = card;
+    c.valores.reserve(2 * rachas.size());
+    for (const Racha& r : rachas) {
+        c.valores.push_back((uint16_t)r.inicio);
+        c.valores.push_back((uint16_t)(r.fin - r.inicio - 1));
+    }
+    return c;
+}
+
+ContenedorRoaring desde_array(uint16_t clave, vector<uint16_t> v) {
+    ContenedorRoaring c;
+    c.clave = clave;
+    c.card = (uint32_t)v.size();
+    size_t num_rachas = v.empty() ? 0 : 1;
+    for (size_t i = 1; i < v.size(); i++) num_rachas += (v[i] != v[i - 1] + 1);
+    if (rachas_mas_pequeno(num_rachas, c.card)) {
+        c.valores = move(v);
+        return con_rachas(clave, a_rachas(c), c.card);
+    }
+    if (c.card > MAX_ARRAY) {
+        c.tipo = ContenedorRoaring::Mapa;
+        c.mapa.assign(PALABRAS, 0);
+        for (uint16_t x : v) c.mapa[x >> 6] |= 1ull << (x & 63);
+        return c;
+    }
+    c.valores = move(v);
+    return c;
+}
+
+ContenedorRoaring desde_mapa(uint16_t clave, vector<uint64_t> m) {
+    ContenedorRoaring c;
+    c.clave = clave;
+    size_t num_rachas = 0;
+    uint64_t acarreo = 0;
+    for (uint64_t w : m) {
+        c.card += (uint32_t)__builtin_popcountll(w);
+        num_rachas += (size_t)__builtin_popcountll(w & ~((w << 1) | acarreo));
+        acarreo = w >> 63;
+    }
+    c.tipo = ContenedorRoaring::Mapa;
+    c.mapa = move(m);
+    if (rachas_mas_pequeno(num_rachas, c.card)) return con_rachas(clave, a_rachas(c), c.card);
+    if (c.card <= MAX_ARRAY) {
+        c.valores = a_array(c);
+        c.mapa.clear();
+        c.mapa.shrink_to_fit();
+        c.tipo = ContenedorRoaring::Array;
+    }
+    return c;
+}
+
+ContenedorRoaring desde_rachas(uint16_t clave, const vector<Racha>& rachas) {
+    uint32_t card = 0;
+    for (const Racha& r : rachas) card += r.fin - r.inicio;
+    ContenedorRoaring c = con_rachas(clave, rachas, card);
+    if (rachas_mas_pequeno(rachas.size(), card)) return c;
+    if (card <= MAX_ARRAY) return desde_array(clave, a_array(c));
+    return desde_mapa(clave, a_mapa(c));
+}
+
+// Racha única [0, L): U y los complementos de conjuntos vacíos
+bool prefijo_lleno(const ContenedorRoaring& c, uint32_t& L) {
+    if (c.tipo != ContenedorRoaring::Rachas || c.valores.size() != 2 || c.valores[0] != 0) return false;
+    L = (uint32_t)c.valores[1] + 1;
+    return true;
+}
+
+uint32_t maximo(const ContenedorRoaring& c) {
+    if (c.tipo == ContenedorRoaring::Array) return c.valores.back();
+    if (c.tipo == ContenedorRoaring::Rachas) return (uint32_t)c.valores[c.valores.size() - 2] + c.valores.back();
+    for (size_t w = PALABRAS; w-- > 0;) {
+        if (c.mapa[w]) return (uint32_t)(w * 64 + 63 - __builtin_clzll(c.mapa[w]));
+    }
+    return 0;
+}
+
+// Resto de casos: palabra a palabra sobre los mapas
+vector<uint64_t> op_mapas(OpRoaring op, const ContenedorRoaring& a, const ContenedorRoaring& b) {
+    vector<uint64_t> m = a_mapa(a);
+    const vector<uint64_t> mb = a_mapa(b);
+    for (size_t w = 0; w < PALABRAS; w++) {
+        switch (op) {
+            case OpRoaring::Union:        m[w] |= mb[w]; break;
+            case OpRoaring::Interseccion: m[w] &= mb[w]; break;
+            case OpRoaring::Diferencia:   m[w] &= ~mb[w]; break;
+            case OpRoaring::DifSimetrica: m[w] ^= mb[w]; break;
+        }
+    }
+    return m;
+}
+
+} // namespace
+
+//------------------------------------------------------------------
+// Elementos sueltos
+//------------------------------------------------------------------
+bool roaring_contiene(const ContenedorRoaring& c, uint16_t x) {
+    if (c.tipo == ContenedorRoaring::Array) return binary_search(c.valores.begin(), c.valores.end(), x);
+    if (c.tipo == ContenedorRoaring::Mapa) return bit(c.mapa, x);
+    // Última racha con inicio <= x
+    size_t lo = 0, hi = c.valores.size() / 2;
+    while (lo < hi) {
+        const size_t m = (lo + hi) / 2;
+        if (c.valores[2 * m] <= x) lo = m + 1; else hi = m;
+    }
+    if (lo == 0) return false;
+    return x <= (uint32_t)c.valores[2 * (lo - 1)] + c.valores[2 * (lo - 1) + 1];
+}
+
+void roaring_insertar(ContenedorRoaring& c, uint16_t x) {
+    if (roaring_contiene(c, x)) return;
+    if (c.tipo == ContenedorRoaring::Rachas) {
+        if (c.card < MAX_ARRAY) {
+            c.valores = a_array(c);
+            c.tipo = ContenedorRoaring::Array;
+        } else {
+            c.mapa = a_mapa(c);
+            c.valores.clear();
+            c.tipo = ContenedorRoaring::Mapa;
+        }
+    }
+    if (c.tipo == ContenedorRoaring::Array && c.card == MAX_ARRAY) {
+        c.mapa = a_mapa(c);
+        c.valores.clear();
+        c.valores.shrink_to_fit();
+        c.tipo = ContenedorRoaring::Mapa;
+    }
+    if (c.tipo == ContenedorRoaring::Array) c.valores.insert(lower_bound(c.valores.begin(), c.valores.end(), x), x);
+    else c.mapa[x >> 6] |= 1ull << (x & 63);
+    c.card++;
+}
+
+void roaring_borrar(ContenedorRoaring& c, uint16_t x) {
+    if (!roaring_contiene(c, x)) return;
+    if (c.tipo == ContenedorRoaring::Rachas) {
+        if (c.card <= MAX_ARRAY) {
+            c.valores = a_array(c);
+            c.tipo = ContenedorRoaring::Array;
+        } else {
+            c.mapa = a_mapa(c);
+            c.valores.clear();
+            c.tipo = ContenedorRoaring::Mapa;
+        }
+    }
+    if (c.tipo == ContenedorRoaring::Array) c.valores.erase(lower_bound(c.valores.begin(), c.valores.end(), x));
+    else c.mapa[x >> 6] &= ~(1ull << (x & 63));
+    c.card--;
+}
+
+//------------------------------------------------------------------
+// Operaciones entre contenedores
+//------------------------------------------------------------------
+ContenedorRoaring roaring_op(OpRoaring op, const ContenedorRoaring& a, const ContenedorRoaring& b) {
+    const uint16_t clave = a.clave;
+    const bool array_a = a.tipo == ContenedorRoaring::Array;
+    const bool array_b = b.tipo == ContenedorRoaring::Array;
+
+    // Con una racha completa (U): el resultado es uno de los operandos
+    uint32_t L = 0;
+    if (op == OpRoaring::Interseccion || op == OpRoaring::Union) {
+        const bool toma_otro = (op == OpRoaring::Interseccion);
+        if (prefijo_lleno(a, L) && maximo(b) < L) return toma_otro ? b : a;
+        if (prefijo_lleno(b, L) && maximo(a) < L) return toma_otro ? a : b;
+    }
+    if (op == OpRoaring::Diferencia && prefijo_lleno(b, L) && maximo(a) < L) return ContenedorRoaring{};
+
+    // Array: coste proporcional a la cardinalidad
+    if (array_a && array_b) {
+        vector<uint16_t> v;
+        const auto ai = a.valores.begin(), af = a.valores.end();
+        const auto bi = b.valores.begin(), bf = b.valores.end();
+        switch (op) {
+            case OpRoaring::Union:        set_union(ai, af, bi, bf, back_inserter(v)); break;
+            case OpRoaring::Interseccion: set_intersection(ai, af, bi, bf, back_inserter(v)); break;
+            case OpRoaring::Diferencia:   set_difference(ai, af, bi, bf, back_inserter(v)); break;
+            case OpRoaring::DifSimetrica: set_symmetric_difference(ai, af, bi, bf, back_inserter(v)); break;
+        }
+        return desde_array(clave, move(v));
+    }
+    if ((op == OpRoaring::Interseccion && (array_a || array_b)) || (op == OpRoaring::Diferencia && array_a)) {
+        const ContenedorRoaring& arr = array_a ? a : b;
+        const ContenedorRoaring& otro = array_a ? b : a;
+        const bool dentro = (op == OpRoaring::Interseccion);
+        vector<uint16_t> v;
+        for (uint16_t x : arr.valores) {
+            if (roaring_contiene(otro, x) == dentro) v.push_back(x);
+        }
+        return desde_array(clave, move(v));
+    }
+    // Dos listas de rachas: mezcla sin pasar por el mapa
+    if (a.tipo == ContenedorRoaring::Rachas && b.tipo == ContenedorRoaring::Rachas &&
+        (op == OpRoaring::Union || op == OpRoaring::Interseccion)) {
+        const vector<Racha> ra = a_rachas(a), rb = a_rachas(b);
+        vector<Racha> r;
+        size_t i = 0, j = 0;
+        if (op == OpRoaring::Union) {
+            while (i < ra.size() || j < rb.size()) {
+                const Racha s = (j == rb.size() || (i < ra.size() && ra[i].inicio < rb[j].inicio)) ? ra[i++] : rb[j++];
+                if (!r.empty() && s.inicio <= r.back().fin) r.back().fin = max(r.back().fin, s.fin);
+                else r.push_back(s);
+            }
+        } else {
+            while (i < ra.size() && j < rb.size()) {
+                const uint32_t ini = max(ra[i].inicio, rb[j].inicio), fin = min(ra[i].fin, rb[j].fin);
+                if (ini < fin) r.push_back({ini, fin});
+                if (ra[i].fin < rb[j].fin) i++; else j++;
+            }
+        }
+        return desde_rachas(clave, r);
+    }
+    return desde_mapa(clave, op_mapas(op, a, b));
+}
+
+ContenedorRoaring roaring_complemento(const ContenedorRoaring& c, uint32_t limite) {
+    vector<Racha> r;
+    uint32_t x = 0;
+    for (const Racha& s : a_rachas(c)) {
+        if (s.inicio > x) r.push_back({x, s.inicio});
+        x = s.fin;
+    }
+    if (x < limite) r.push_back({x, limite});
+    return desde_rachas(c.clave, r);
+}
+
+ContenedorRoaring roaring_lleno(uint16_t clave, uint32_t limite) {
+    return con_rachas(clave, {Racha{0, limite}}, limite);
+}
+
+//------------------------------------------------------------------
+// Comparación, hash y recorrido
+//------------------------------------------------------------------
+bool roaring_iguales(const ContenedorRoaring& a, const ContenedorRoaring& b) {
+    if (a.clave != b.clave || a.card != b.card) return false;
+    if (a.tipo == b.tipo) return a.tipo == ContenedorRoaring::Mapa ? a.mapa == b.mapa : a.valores == b.valores;
+    return a_rachas(a) == a_rachas(b);
+}
+
+size_t roaring_hash(const ContenedorRoaring& c) {
+    // Sobre las rachas: no depende del tipo de contenedor
+    size_t h = hash<uint32_t>()(((uint32_t)c.clave << 16) ^ c.card);
+    for (const Racha& r : a_rachas(c)) {
+        h ^= hash<uint32_t>()((r.inicio << 16) ^ r.fin) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+    }
+    return h;
+}
+
+long roaring_siguiente(const ContenedorRoaring& c, uint32_t desde) {
+    if (c.tipo == ContenedorRoaring::Array) {
+        const auto it = lower_bound(c.valores.begin(), c.valores.end(), desde);
+        return it == c.valores.end() ? -1 : (long)*it;
+    }
+    if (c.tipo == ContenedorRoaring::Mapa) {
+        const uint32_t x = buscar_bit(c.mapa, desde, true);
+        return x == BLOQUE_ROARING ? -1 : (long)x;
+    }
+    for (size_t i = 0; i < c.valores.size(); i += 2) {
+        const uint32_t fin = (uint32_t)c.valores[i] + c.valores[i + 1];
+        if (fin >= desde) return (long)max<uint32_t>(desde, c.valores[i]);
+    }
+    return -1;
+}
+
+size_t roaring_memoria(const ContenedorRoaring& c) {
+    return c.valores.capacity() * sizeof(uint16_t) + c.mapa.capacity() * sizeof(uint64_t);
+}
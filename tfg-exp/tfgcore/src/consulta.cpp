@@ -0,0 +1,112 @@
+//----------------------------------------------------------------------
+// consulta.cpp
+//----------------------------------------------------------------------
+// Mínimo número de operaciones para Jaccard >= tau (y |H| <= m).
+//----------------------------------------------------------------------
+
+#include "consulta.hpp"
+
+#include <functional>
+#include <set>
+#include <string>
+#include <unordered_set>
+
+#include "metrics.hpp"
+
+using namespace std;
+
+namespace {
+
+// Conjunto y, si hay límite de |H|, los F_i usados
+struct ClaveExpr {
+    Bitset conjunto;
+    set<int> usados;
+    bool operator==(const ClaveExpr& o) const { return conjunto == o.conjunto && usados == o.usados; }
+};
+
+struct HashClaveExpr {
+    size_t operator()(const ClaveExpr& c) const {
+        size_t h = hash<Bitset>()(c.conjunto);
+        for (int i : c.usados) h = h * 1000003u ^ (size_t)(i + 1);
+        return h;
+    }
+};
+
+} // namespace
+
+//------------------------------------------------------------------
+// Búsqueda por niveles
+//------------------------------------------------------------------
+ResultadoConsulta consulta_min_ops(const vector<Bitset>& F, const Bitset& U, const Bitset& G,
+                                   const ParametrosConsulta& params, const TablaAtomos* atomos) {
+    ResultadoConsulta r;
+    if (atomos) r.cota = cota_jaccard(*atomos, G);
+    else r.cota = cota_jaccard(construir_atomos(F, U), G);
+
+    // Margen para comparar con tau sin falsos negativos por redondeo
+    const double tau = params.tau - 1e-12;
+    if (r.cota < tau) return r;
+
+    const bool limitar_H = params.max_sizeH >= 0;
+    unordered_set<ClaveExpr, HashClaveExpr> vistos;
+    auto nueva = [&](const Bitset& c, const set<int>& usados) {
+        return vistos.insert(limitar_H ? ClaveExpr{c, usados} : ClaveExpr{c, {}}).second;
+    };
+
+    // Devuelve true (y rellena r) si 'e' cumple la restricción
+    auto comprobar = [&](const Expression& e) {
+        r.expresiones++;
+        const int sizeH = (int)M(e, G, Metric::SizeH);
+        if (limitar_H && sizeH > params.max_sizeH) return false;
+        const double j = M(e, G, Metric::Jaccard);
+        if (j < tau) return false;
+        r.encontrada = true;
+        r.solucion = SolMO(e, e.n_ops, sizeH, j);
+        return true;
+    };
+
+    // Nivel 0: U y los F_i (U no cuenta en |H|, como en la exhaustiva)
+    vector<vector<Expression>> expr(1);
+    r.niveles = 1;
+    for (int i = -1; i < (int)F.size(); i++) {
+        Expression e = (i == -1)
+            ? Expression(U, "U", {}, 0)
+            : Expression(F[i], "F" + to_string(i), {i}, 0);
+        if (limitar_H && (int)e.used_sets.size() > params.max_sizeH) continue;
+        if (!nueva(e.conjunto, e.used_sets)) continue;
+        if (comprobar(e)) return r;
+        expr[0].push_back(move(e));
+    }
+
+    for (int s = 1; s <= params.max_ops; s++) {
+        expr.emplace_back();
+        r.niveles = s + 1;
+        for (int op = 0; op < 3; op++) {
+            const bool conmutativa = (op != 2);
+            for (int a = 0; a < s; a++) {
+                const int b = s - 1 - a;
+                if (conmutativa && a > b) continue;
+                const vector<Expression>& izq = expr[a];
+                const vector<Expression>& der = expr[b];
+                for (size_t i = 0; i < izq.size(); i++) {
+                    const Expression& L = izq[i];
+                    const size_t j0 = (conmutativa && a == b) ? i + 1 : 0;
+                    for (size_t j = j0; j < der.size(); j++) {
+                        const Expression& R = der[j];
+                        const Bitset c = apply_op(op, L.conjunto, R.conjunto);
+                        if (c == L.conjunto || c == R.conjunto) continue;
+
+                        set<int> usados = L.used_sets;
+                        usados.insert(R.used_sets.begin(), R.used_sets.end());
+                        if (limitar_H && (int)usados.size() > params.max_sizeH) continue;
+                        if (!nueva(c, usados)) continue;
+
+                        expr[s].emplace_back(c, "(" + L.expr_str + texto_op(op) + R.expr_str + ")", usados, s);
+                        if (comprobar(expr[s].back())) return r;
+                    }
+                }
+            }
+        }
+    }
+    return r;
+}
@@ -0,0 +1,244 @@
+//----------------------------------------------------------------------
+// decision_sat.cpp
+//----------------------------------------------------------------------
+// Decisión exacta (Jaccard = 1 con <= k operaciones) mediante SAT.
+//----------------------------------------------------------------------
+
+#include "decision_sat.hpp"
+
+#include <stdexcept>
+#include <string>
+
+#include "atomos.hpp"
+
+using namespace std;
+
+const char* nombre_estado(EstadoSAT e) {
+    switch (e) {
+        case EstadoSAT::SAT:   return "SI";
+        case EstadoSAT::UNSAT: return "NO";
+        default:               return "DESCONOCIDO";
+    }
+}
+
+namespace {
+
+//------------------------------------------------------------------
+// Codificación
+//------------------------------------------------------------------
+struct Codificacion {
+    int entradas = 0;                       // U y F_i
+    int pasos = 0;                          // k
+    vector<vector<int>> x, L, R;            // [paso][átomo]
+    vector<vector<int>> sel_izq, sel_der;   // [paso][nodo anterior]
+    vector<vector<int>> op;                 // [paso][0..2]
+    vector<int> salida;                     // [nodo]
+};
+
+void exactamente_uno(SolverSAT& S, const vector<int>& vars) {
+    S.anadir_clausula(vars);
+    for (size_t a = 0; a < vars.size(); a++) {
+        for (size_t b = a + 1; b < vars.size(); b++) S.anadir_clausula({-vars[a], -vars[b]});
+    }
+}
+
+void a_lo_sumo_uno(SolverSAT& S, const vector<int>& vars) {
+    for (size_t a = 0; a < vars.size(); a++) {
+        for (size_t b = a + 1; b < vars.size(); b++) S.anadir_clausula({-vars[a], -vars[b]});
+    }
+}
+
+/* entrada[v][a]: valor de la entrada v (U, F_0, ...) en el átomo a;
+    objetivo[a]: valor de G en el átomo a */
+Codificacion codificar(SolverSAT& S, const vector<vector<char>>& entrada,
+                       const vector<char>& objetivo, int k) {
+    Codificacion c;
+    c.entradas = (int)entrada.size();
+    c.pasos = k;
+    const int n = c.entradas;
+    const int A = (int)objetivo.size();
+    auto nuevas = [&](int cuantas) {
+        vector<int> v(cuantas);
+        for (int& x : v) x = S.nueva_variable();
+        return v;
+    };
+
+    for (int j = 0; j < k; j++) {
+        c.x.push_back(nuevas(A));
+        c.L.push_back(nuevas(A));
+        c.R.push_back(nuevas(A));
+        c.sel_izq.push_back(nuevas(n + j));
+        c.sel_der.push_back(nuevas(n + j));
+        c.op.push_back(nuevas(3));
+    }
+    c.salida = nuevas(n + k);
+
+    for (int j = 0; j < k; j++) {
+        exactamente_uno(S, c.sel_izq[j]);
+        exactamente_uno(S, c.sel_der[j]);
+        exactamente_uno(S, c.op[j]);
+        const int o_union = c.op[j][0], o_inter = c.op[j][1], o_dif = c.op[j][2];
+
+        // Valor de los operandos según el nodo elegido
+        for (int v = 0; v < n + j; v++) {
+            const int si = c.sel_izq[j][v], sd = c.sel_der[j][v];
+            for (int a = 0; a < A; a++) {
+                if (v < n) {
+                    const int signo = entrada[v][a] ? 1 : -1;
+                    S.anadir_clausula({-si, signo * c.L[j][a]});
+                    S.anadir_clausula({-sd, signo * c.R[j][a]});
+                } else {
+                    const int xv = c.x[v - n][a];
+                    S.anadir_clausula({-si, -xv, c.L[j][a]});
+                    S.anadir_clausula({-si, xv, -c.L[j][a]});
+                    S.anadir_clausula({-sd, -xv, c.R[j][a]});
+                    S.anadir_clausula({-sd, xv, -c.R[j][a]});
+                }
+            }
+        }
+
+        // Resultado del paso según la operación
+        for (int a = 0; a < A; a++) {
+            const int x = c.x[j][a], l = c.L[j][a], r = c.R[j][a];
+            // x = l ∪ r
+            S.anadir_clausula({-o_union, -x, l, r});
+            S.anadir_clausula({-o_union, x, -l});
+            S.anadir_clausula({-o_union, x, -r});
+            // x = l ∩ r
+            S.anadir_clausula({-o_inter, x, -l, -r});
+            S.anadir_clausula({-o_inter, -x, l});
+            S.anadir_clausula({-o_inter, -x, r});
+            // x = l \ r
+            S.anadir_clausula({-o_dif, x, -l, r});
+            S.anadir_clausula({-o_dif, -x, l});
+            S.anadir_clausula({-o_dif, -x, -r});
+        }
+
+        // Simetrías: en ∪ y ∩, izquierdo < derecho
+        for (int v = 0; v < n + j; v++) {
+            for (int w = 0; w <= v; w++) {
+                S.anadir_clausula({-c.sel_izq[j][v], -c.sel_der[j][w], o_dif});
+            }
+        }
+    }
+
+    // Árbol: cada paso se usa a lo sumo una vez
+    for (int m = 0; m < k; m++) {
+        vector<int> usos = {c.salida[n + m]};
+        for (int j = m + 1; j < k; j++) {
+            usos.push_back(c.sel_izq[j][n + m]);
+            usos.push_back(c.sel_der[j][n + m]);
+        }
+        a_lo_sumo_uno(S, usos);
+    }
+
+    // Salida: algún nodo igual a G
+    S.anadir_clausula(c.salida);
+    for (int v = 0; v < n; v++) {
+        if (entrada[v] != objetivo) S.anadir_clausula({-c.salida[v]});
+    }
+    for (int m = 0; m < k; m++) {
+        for (int a = 0; a < A; a++) {
+            S.anadir_clausula({-c.salida[n + m], objetivo[a] ? c.x[m][a] : -c.x[m][a]});
+        }
+    }
+    return c;
+}
+
+//------------------------------------------------------------------
+// Extracción del testigo
+//------------------------------------------------------------------
+struct Extractor {
+    const SolverSAT& S;
+    const Codificacion& c;
+    const vector<Bitset>& F;
+    const Bitset& U;
+
+    int elegido(const vector<int>& vars) const {
+        for (size_t i = 0; i < vars.size(); i++) {
+            if (S.valor(vars[i])) return (int)i;
+        }
+        throw logic_error("Modelo SAT sin selección");
+    }
+
+    Expression nodo(int v) const {
+        if (v == 0) return Expression(U, "U", {}, 0);
+        if (v < c.entradas) return Expression(F[v - 1], "F" + to_string(v - 1), {v - 1}, 0);
+        const int j = v - c.entradas;
+        const int o = elegido(c.op[j]);
+        Expression a = nodo(elegido(c.sel_izq[j]));
+        Expression b = nodo(elegido(c.sel_der[j]));
+        Expression e(apply_op(o, a.conjunto, b.conjunto),
+                     "(" + a.expr_str + texto_op(o) + b.expr_str + ")",
+                     a.used_sets, a.n_ops + b.n_ops + 1);
+        e.used_sets.insert(b.used_sets.begin(), b.used_sets.end());
+        return e;
+    }
+};
+
+} // namespace
+
+//------------------------------------------------------------------
+// Interfaz
+//------------------------------------------------------------------
+ResultadoDecision decidir_exacto(const vector<Bitset>& F, const Bitset& U, const Bitset& G,
+                                 const ParametrosDecision& params) {
+    if (params.max_ops < 0) throw invalid_argument("k debe ser >= 0");
+    ResultadoDecision r;
+    const int k = params.max_ops;
+    const int num_k = params.incremental ? k + 1 : 1;
+
+    // Átomos: G tiene que ser unión de átomos de U
+    const TablaAtomos t = construir_atomos(F, U);
+    r.atomos = (int)t.tam.size();
+    vector<int> representante(r.atomos, -1);
+    bool alcanzable = true;
+    for (int i = 0; i < U_size; i++) {
+        const int a = t.atomo[i];
+        if (a < 0) {
+            if (G[i]) alcanzable = false;
+            continue;
+        }
+        if (representante[a] < 0) representante[a] = i;
+        else if (G[i] != G[representante[a]]) alcanzable = false;
+    }
+    if (!alcanzable) {
+        r.estado = EstadoSAT::UNSAT;
+        r.por_k.assign(num_k, EstadoSAT::UNSAT);
+        return r;
+    }
+
+    vector<vector<char>> entrada(F.size() + 1, vector<char>(r.atomos));
+    vector<char> objetivo(r.atomos);
+    for (int a = 0; a < r.atomos; a++) {
+        const int i = representante[a];
+        entrada[0][a] = U[i];
+        for (size_t f = 0; f < F.size(); f++) entrada[f + 1][a] = F[f][i];
+        objetivo[a] = G[i];
+    }
+
+    SolverSAT S;
+    const Codificacion c = codificar(S, entrada, objetivo, k);
+    r.variables = S.num_variables();
+    r.clausulas = S.num_clausulas();
+
+    for (int kk = params.incremental ? 0 : k; kk <= k; kk++) {
+        // Salida entre las entradas y los kk primeros pasos
+        vector<int> supuestos;
+        for (int v = c.entradas + kk; v < c.entradas + k; v++) supuestos.push_back(-c.salida[v]);
+        const EstadoSAT e = S.resolver(supuestos, params.max_conflictos);
+        r.por_k.push_back(e);
+        if (e != EstadoSAT::SAT) continue;
+
+        int salida = 0;
+        while (!S.valor(c.salida[salida])) salida++;
+        r.testigo = Extractor{S, c, F, U}.nodo(salida);
+        if (r.testigo.conjunto != G) throw logic_error("Testigo SAT distinto de G");
+        r.estado = EstadoSAT::SAT;
+        break;
+    }
+    // "<= k'" es monótono: NO en el último k' implica NO en todos
+    if (r.estado != EstadoSAT::SAT && r.por_k.back() == EstadoSAT::UNSAT) r.estado = EstadoSAT::UNSAT;
+    r.sat = S.stats;
+    return r;
+}
@@ -0,0 +1,144 @@
+//----------------------------------------------------------------------
+// encuentro.cpp
+//----------------------------------------------------------------------
+// Búsqueda bidireccional (meet-in-the-middle) de G exacto.
+//----------------------------------------------------------------------
+
+#include "encuentro.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include "atomos.hpp"
+
+using namespace std;
+
+//------------------------------------------------------------------
+// Tabla: conjuntos distintos con <= h operaciones, por niveles
+//------------------------------------------------------------------
+static void construir_tabla(const vector<Bitset>& F, const Bitset& U, int h,
+                            vector<Expression>& tabla, unordered_map<Bitset, int>& indice) {
+    auto anadir = [&](vector<Expression>& destino, Expression e, size_t base) {
+        if (indice.emplace(e.conjunto, (int)(base + destino.size())).second) destino.push_back(move(e));
+    };
+
+    vector<Expression> nivel0;
+    anadir(nivel0, Expression(U, "U", {}, 0), 0);
+    for (int i = 0; i < (int)F.size(); i++) anadir(nivel0, Expression(F[i], "F" + to_string(i), {i}, 0), 0);
+    tabla = move(nivel0);
+
+    // limites[s]: primera entrada con s operaciones
+    vector<size_t> limites = {0, tabla.size()};
+    for (int s = 1; s <= h; s++) {
+        vector<Expression> nuevo;
+        for (int op = 0; op < 3; op++) {
+            const bool conmutativa = (op != 2);
+            for (int a = 0; a < s; a++) {
+                const int b = s - 1 - a;
+                if (conmutativa && a > b) continue;
+                for (size_t i = limites[a]; i < limites[a + 1]; i++) {
+                    const Expression& L = tabla[i];
+                    const size_t j0 = (conmutativa && a == b) ? i + 1 : limites[b];
+                    for (size_t j = j0; j < limites[b + 1]; j++) {
+                        const Expression& R = tabla[j];
+                        const Bitset c = apply_op(op, L.conjunto, R.conjunto);
+                        if (c == L.conjunto || c == R.conjunto || indice.count(c)) continue;
+                        Expression e(c, "(" + L.expr_str + texto_op(op) + R.expr_str + ")", L.used_sets, s);
+                        e.used_sets.insert(R.used_sets.begin(), R.used_sets.end());
+                        anadir(nuevo, move(e), tabla.size());
+                    }
+                }
+            }
+        }
+        for (auto& e : nuevo) tabla.push_back(move(e));
+        limites.push_back(tabla.size());
+    }
+}
+
+//------------------------------------------------------------------
+// Encuentro
+//------------------------------------------------------------------
+ResultadoEncuentro busqueda_encuentro(const vector<Bitset>& F, const Bitset& U, const Bitset& G, int k) {
+    if (k < 0) throw invalid_argument("k debe ser >= 0");
+    ResultadoEncuentro r;
+    r.profundidad_tabla = k / 2;
+
+    // Si G parte algún átomo, ninguna expresión lo alcanza
+    if (cota_jaccard(construir_atomos(F, U), G) < 1.0) return r;
+
+    vector<Expression> tabla;
+    unordered_map<Bitset, int> indice;
+    construir_tabla(F, U, r.profundidad_tabla, tabla, indice);
+    r.tabla = tabla.size();
+
+    // G directamente en la tabla (mínimo exacto)
+    auto directo = indice.find(G);
+    if (directo != indice.end()) {
+        r.encontrada = true;
+        r.expresion = tabla[directo->second];
+        return r;
+    }
+
+    // Mejor par (X, Y, op) con menos operaciones en total (<= k)
+    int mejor = k + 1, mejor_x = -1, mejor_y = -1, mejor_op = -1;
+    auto probar = [&](int x, int y, int op) {
+        r.pares++;
+        const int total = tabla[x].n_ops + tabla[y].n_ops + 1;
+        if (total >= mejor || apply_op(op, tabla[x].conjunto, tabla[y].conjunto) != G) return;
+        mejor = total;
+        mejor_x = x;
+        mejor_y = y;
+        mejor_op = op;
+    };
+    auto buscar = [&](const Bitset& c) {
+        auto it = indice.find(c);
+        return it == indice.end() ? -1 : it->second;
+    };
+
+    // Listas filtradas (en orden de operaciones, como la tabla)
+    const Bitset fuera_G = U & ~G;
+    vector<int> sub_G, sup_G, disj_G;
+    for (int x = 0; x < (int)tabla.size(); x++) {
+        const Bitset& X = tabla[x].conjunto;
+        if ((X & ~G).none()) sub_G.push_back(x);
+        if ((G & ~X).none()) sup_G.push_back(x);
+        if ((X & G).none()) disj_G.push_back(x);
+    }
+
+    // 1) Por hash: el compañero en un extremo del intervalo
+    for (int x : sub_G) {
+        const int y = buscar(G & ~tabla[x].conjunto);
+        if (y >= 0) probar(x, y, 0);
+    }
+    for (int x : sup_G) {
+        const Bitset& X = tabla[x].conjunto;
+        int y = buscar(G | (U & ~X));
+        if (y >= 0) probar(x, y, 1);
+        y = buscar(X & fuera_G);
+        if (y >= 0) probar(x, y, 2);
+    }
+
+    // 2) Pares de las listas filtradas, podando por el total de operaciones
+    auto barrer = [&](const vector<int>& A, const vector<int>& B, int op, bool simetrica) {
+        for (size_t i = 0; i < A.size(); i++) {
+            const int ops_x = tabla[A[i]].n_ops;
+            if (ops_x + 1 >= mejor) break;
+            for (size_t j = simetrica ? i + 1 : 0; j < B.size(); j++) {
+                if (ops_x + tabla[B[j]].n_ops + 1 >= mejor) break;
+                probar(A[i], B[j], op);
+            }
+        }
+    };
+    barrer(sub_G, sub_G, 0, true);
+    barrer(sup_G, sup_G, 1, true);
+    barrer(sup_G, disj_G, 2, false);
+
+    if (mejor_op < 0) return r;
+    const Expression& X = tabla[mejor_x];
+    const Expression& Y = tabla[mejor_y];
+    r.encontrada = true;
+    r.expresion = Expression(G, "(" + X.expr_str + texto_op(mejor_op) + Y.expr_str + ")", X.used_sets, mejor);
+    r.expresion.used_sets.insert(Y.used_sets.begin(), Y.used_sets.end());
+    return r;
+}
@@ -11,10 +11,14 @@
 
 #include "metrics.hpp"
 #include "exhaustiva.hpp"
+#include "niveles.hpp"
 #include "solutions.hpp"
 
 using namespace std;
 
+// Candidatas por tanda de filas (se pasan al frente en orden)
+static constexpr size_t CANDIDATAS_POR_TANDA = 1 << 16;
+
 //------------------------------------------------------------------
 /* Genera todas las expresiones posibles hasta profundidad k
     a partir de la familia F y el universo U. */
@@ -25,78 +29,67 @@ std::vector<SolMO> exhaustive_search(
     const Bitset& G,
     int k)
 {
-    vector<vector<Expression>> expr(k + 1);
-    vector<SolMO> soluciones;
+    // Niveles 0..k-1 guardados (el k no se combina con nadie)
+    vector<NivelSoA> niveles(max(k, 1));
+    vector<vector<BloqueNivel>> bloques(k + 1);
+    const int card_G = (int)G.count();
 
-    // Nivel 0: conjuntos base + conjunto universo
-    expr[0].reserve(F.size() + 1);
+    // Frente por partes, en el orden en que se generan las expresiones
+    vector<CandidataNivel> frente;
+    vector<CandidataNivel> tanda;
 
-    // Nivel 0: añadir conjunto universo + conjuntos base
-    for (int i = -1; i < (int)F.size(); i++) {
-        if (i==-1) {
-            set<int> u_set ={};
-            expr[0].emplace_back(U, "U", u_set, 0);
-        }
-        else {
-            set<int> sets = {i};
-            expr[0].emplace_back(F[i], "F" + to_string(i), sets, 0);
-        }
-
-        // Evaluar cada expresión de nivel 0
-        const Expression& e = expr[0].back();
-        double j = M(e, G, Metric::Jaccard);
-        int sizeH = M(e, G, Metric::SizeH);
-        int n_ops = M(e, G, Metric::OpSize);
-        soluciones.emplace_back(e, n_ops, sizeH, j);
+    // Nivel 0: conjunto universo + conjuntos base
+    niveles[0] = nivel_base(F, U);
+    for (size_t i = 0; i < niveles[0].size(); i++) {
+        CandidataNivel c;
+        c.jaccard = jaccard_con_cardinal(niveles[0].conjuntos[i], G, card_G);
+        c.sizeH = i == 0 ? 0 : 1;
+        c.indice = i;
+        anadir_no_dominada(frente, c);
     }
+    contar_evaluaciones(niveles[0].size());
 
     // Generar expresiones con s operaciones (1...k)
     for (int s = 1; s <= k; s++) {
+        // Bloques en el orden (op, a) de la generación
+        size_t total = 0;
         for (int op = 0; op < 3; op++) {
-            string op_str = (op == 0) ? " ∪ " : (op == 1) ? " ∩ " : " \\ ";
-            
             for (int a = 0; a < s; a++) {
-                int b = s - a - 1;
-
-                for (const auto& left : expr[a]) {
-                    for (const auto& right : expr[b]) {
-                        
-                        // Aplicar operación
-                        Bitset new_set;
-                        if (op == 0) {
-                            new_set = set_union(left.conjunto, 
-                                               right.conjunto);
-                        } else if (op == 1) {
-                            new_set = set_intersect(left.conjunto, 
-                                               right.conjunto);
-                        } else {
-                            new_set = set_difference(left.conjunto, 
-                                               right.conjunto);
-                        }
-                        
-                        // Crear nueva expresión
-                        string new_expr = "(" + left.expr_str + op_str + 
-                                         right.expr_str + ")";
-                        
-                        // Combinar conjuntos usados
-                        set<int> combined_sets = left.used_sets;
-                        combined_sets.insert(right.used_sets.begin(), right.used_sets.end());
-                        
-                        // Almacenar nueva expresión
-                        expr[s].emplace_back(new_set, new_expr, combined_sets, s);
+                const int b = s - a - 1;
+                bloques[s].push_back({op, a, b, total});
+                total += niveles[a].size() * niveles[b].size();
+            }
+        }
+        NivelSoA* destino = nullptr;
+        if (s < k) {
+            niveles[s].palabras = niveles[0].palabras;
+            niveles[s].redimensionar(total);
+            destino = &niveles[s];
+        }
 
-                        // Evaluar nueva expresión
-                        const Expression& e_nueva = expr[s].back();
-                        double j = M(e_nueva, G, Metric::Jaccard);
-                        int sizeH = M(e_nueva, G, Metric::SizeH);
-                        soluciones.emplace_back(e_nueva, s, sizeH, j);
-                    }
-                }
+        for (const BloqueNivel& bl : bloques[s]) {
+            const NivelSoA& izq = niveles[bl.a];
+            const NivelSoA& der = niveles[bl.b];
+            if (der.size() == 0) continue;
+            const size_t filas = max<size_t>(1, CANDIDATAS_POR_TANDA / der.size());
+            for (size_t f0 = 0; f0 < izq.size(); f0 += filas) {
+                const size_t f1 = min(izq.size(), f0 + filas);
+                tanda.resize((f1 - f0) * der.size());
+                combinar_filas_op(bl.op, izq, f0, f1, der, G, card_G, s, tanda.data(), destino, bl.base);
+                contar_evaluaciones(tanda.size());
+                for (const auto& c : tanda) anadir_no_dominada(frente, c);
             }
         }
     }
-    // Filtrar frente de Pareto
-    return pareto_front(soluciones);
+
+    // Filtrar frente de Pareto y rehacer sus expresiones
+    ordenar_frente(frente);
+    vector<SolMO> soluciones;
+    soluciones.reserve(frente.size());
+    for (const auto& c : frente) {
+        soluciones.emplace_back(rehacer_expresion(niveles, bloques, c.n_ops, c.indice), c.n_ops, c.sizeH, c.jaccard);
+    }
+    return soluciones;
 }
 
 //------------------------------------------------------------------
@@ -6,6 +6,12 @@
 
 #include "generator.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
 using namespace std;
 
 // -----------------------------------------------------------------------------
@@ -73,4 +79,178 @@ vector<Bitset> generar_F(int n, int n_min, int n_max,
     }
     
     return F;
-}
\ No newline at end of file
+}
+
+// -----------------------------------------------------------------------------
+// Generador escalable
+// -----------------------------------------------------------------------------
+// Mezcla de semillas (splitmix64): semillas independientes por conjunto
+static uint64_t mezclar_semilla(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+static inline bool bit(const vector<uint64_t>& w, uint64_t i) { return (w[i / 64] >> (i % 64)) & 1; }
+static inline void poner_bit(vector<uint64_t>& w, uint64_t i) { w[i / 64] |= (uint64_t)1 << (i % 64); }
+
+// Elementos de un conjunto empaquetado (ordenados)
+static vector<uint64_t> elementos(const vector<uint64_t>& w) {
+    vector<uint64_t> r;
+    for (size_t p = 0; p < w.size(); p++) {
+        uint64_t x = w[p];
+        while (x) {
+            r.push_back(p * 64 + __builtin_ctzll(x));
+            x &= x - 1;
+        }
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+/* Algoritmo de Floyd: elige m índices distintos de [0, N) sin bucles de
+    rechazo. 'elemento(t)' traduce el índice t al elemento del universo,
+    que se marca en w (w también sirve como test de pertenencia). */
+// -----------------------------------------------------------------------------
+template<typename Traducir>
+static void muestreo_floyd(uint64_t N, uint64_t m, vector<uint64_t>& w,
+                           mt19937_64& rng, Traducir elemento) {
+    if (m > N) m = N;
+    for (uint64_t j = N - m; j < N; j++) {
+        uint64_t x = elemento(uniform_int_distribution<uint64_t>(0, j)(rng));
+        if (bit(w, x)) x = elemento(j);
+        poner_bit(w, x);
+    }
+}
+
+// -----------------------------------------------------------------------------
+/* Traducción de índice a elemento de [0, n) \ excluidos (ordenado):
+    el r-ésimo elemento libre es r + j, con j = #{i : excluidos[i] - i <= r}. */
+// -----------------------------------------------------------------------------
+static uint64_t rango_a_elemento(uint64_t r, const vector<uint64_t>& excluidos) {
+    size_t lo = 0, hi = excluidos.size();
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (excluidos[mid] - mid <= r) lo = mid + 1;
+        else hi = mid;
+    }
+    return r + lo;
+}
+
+// -----------------------------------------------------------------------------
+/* Muestreo sobre una lista o sobre [0, n) \ excluidos. Si se piden más de
+    la mitad de los candidatos se muestrean los que quedan fuera y se marca
+    el resto de un barrido. */
+// -----------------------------------------------------------------------------
+// Muestrea m elementos de 'lista' y los marca en w
+static void muestrear_de_lista(const vector<uint64_t>& lista, uint64_t m,
+                               vector<uint64_t>& w, mt19937_64& rng) {
+    auto elemento = [&](uint64_t t) { return lista[t]; };
+    if (2 * m <= lista.size()) {
+        muestreo_floyd(lista.size(), m, w, rng, elemento);
+        return;
+    }
+    vector<uint64_t> fuera(w.size(), 0);
+    muestreo_floyd(lista.size(), lista.size() - m, fuera, rng, elemento);
+    for (uint64_t x : lista) {
+        if (!bit(fuera, x)) poner_bit(w, x);
+    }
+}
+
+// Muestrea m elementos de [0, n) \ excluidos y los marca en w
+static void muestrear_fuera_de(uint64_t n, const vector<uint64_t>& excluidos, uint64_t m,
+                               vector<uint64_t>& w, mt19937_64& rng) {
+    const uint64_t N = n - excluidos.size();
+    auto elemento = [&](uint64_t t) { return rango_a_elemento(t, excluidos); };
+    if (2 * m <= N) {
+        muestreo_floyd(N, m, w, rng, elemento);
+        return;
+    }
+    // Complemento: ni los no elegidos ni los excluidos
+    vector<uint64_t> fuera(w.size(), 0);
+    muestreo_floyd(N, N - min(m, N), fuera, rng, elemento);
+    for (uint64_t x : excluidos) poner_bit(fuera, x);
+    for (size_t p = 0; p < w.size(); p++) w[p] |= ~fuera[p];
+    if (n % 64) w.back() &= ((uint64_t)1 << (n % 64)) - 1;
+}
+
+InstanciaEmpaquetada generar_instancia_escalable(const GenEscalableConfig& cfg) {
+    if (cfg.n == 0 || cfg.F_n < 0 || cfg.num_grupos < 1 ||
+        cfg.Fi_size_min > cfg.Fi_size_max || cfg.G_size_min > cfg.G_size_max) {
+        throw invalid_argument("Configuración de generación inválida");
+    }
+
+    const uint64_t n = cfg.n;
+    const uint64_t wpc = palabras_para(n);
+    const double corr = min(1.0, max(0.0, cfg.correlacion));
+    const double solap = min(1.0, max(0.0, cfg.solapamiento));
+
+    InstanciaEmpaquetada inst;
+    inst.universo = n;
+    inst.seed = cfg.seed;
+    inst.F.assign(cfg.F_n, vector<uint64_t>(wpc, 0));
+
+    // Centros de los grupos (solo si hay correlación)
+    vector<vector<uint64_t>> centros;
+    if (corr > 0.0) {
+        centros.resize(cfg.num_grupos);
+        for (int g = 0; g < cfg.num_grupos; g++) {
+            mt19937_64 rng(mezclar_semilla(cfg.seed ^ (0xC0FFEEULL + (uint64_t)g)));
+            vector<uint64_t> w(wpc, 0);
+            muestrear_fuera_de(n, {}, min(cfg.Fi_size_max, n), w, rng);
+            centros[g] = elementos(w);
+        }
+    }
+
+    // Generación de un F_i (solo depende de su semilla)
+    auto generar_Fi = [&](int i) {
+        mt19937_64 rng(mezclar_semilla(cfg.seed + (uint64_t)i + 1));
+        uint64_t m = min(uniform_int_distribution<uint64_t>(cfg.Fi_size_min, cfg.Fi_size_max)(rng), n);
+        vector<uint64_t>& w = inst.F[i];
+
+        // Parte correlacionada: elementos del centro del grupo
+        vector<uint64_t> del_centro;
+        if (!centros.empty()) {
+            const auto& centro = centros[i % cfg.num_grupos];
+            uint64_t c = min<uint64_t>((uint64_t)llround(corr * m), centro.size());
+            muestrear_de_lista(centro, c, w, rng);
+            del_centro = elementos(w);
+        }
+        // Resto: uniforme fuera de lo ya elegido
+        muestrear_fuera_de(n, del_centro, m - del_centro.size(), w, rng);
+    };
+
+    // F_i en paralelo (resultado determinista: cada F_i tiene su semilla)
+    int hilos = cfg.hilos > 0 ? cfg.hilos : (int)max(1u, thread::hardware_concurrency());
+    hilos = max(1, min(hilos, cfg.F_n));
+    atomic<int> siguiente(0);
+    vector<thread> trabajadores;
+    for (int h = 0; h < hilos; h++) {
+        trabajadores.emplace_back([&]() {
+            for (int i = siguiente++; i < cfg.F_n; i = siguiente++) generar_Fi(i);
+        });
+    }
+    for (auto& t : trabajadores) t.join();
+
+    // G: fracción 'solapamiento' dentro de la unión de F, resto fuera de ella
+    mt19937_64 rng_G(mezclar_semilla(cfg.seed ^ 0x6A09E667F3BCC908ULL));
+    uint64_t g = min(uniform_int_distribution<uint64_t>(cfg.G_size_min, cfg.G_size_max)(rng_G), n);
+
+    vector<uint64_t> union_F(wpc, 0);
+    for (const auto& Fi : inst.F)
+        for (uint64_t p = 0; p < wpc; p++) union_F[p] |= Fi[p];
+    vector<uint64_t> elems_union = elementos(union_F);
+
+    inst.G.assign(wpc, 0);
+    uint64_t dentro = min<uint64_t>((uint64_t)llround(solap * g), elems_union.size());
+    uint64_t fuera = min<uint64_t>(g - dentro, n - elems_union.size());
+    muestrear_de_lista(elems_union, dentro, inst.G, rng_G);
+    muestrear_fuera_de(n, elems_union, fuera, inst.G, rng_G);
+
+    return inst;
+}
+
+void generar_instancia_escalable(const GenEscalableConfig& cfg, const string& path) {
+    guardar_instancia_empaquetada(path, generar_instancia_escalable(cfg));
+}
@@ -5,7 +5,10 @@
 //----------------------------------------------------------------------
 
 #include "genetico.hpp"
+#include "indicadores.hpp"
+#include "memetica.hpp"
 #include "metrics.hpp"
+#include "simplificacion.hpp"
 
 #include<iomanip>
 #include <algorithm>
@@ -19,6 +22,9 @@
 
 using namespace std;
 
+// Repetidos seguidos que se toleran al crear la población inicial
+static const int MAX_REINTENTOS_INICIAL = 1000;
+
 //------------------------------------------------------------------
 // Construcción aleatoria de expresiones (individuos)
 //------------------------------------------------------------------
@@ -91,6 +97,94 @@ Expression build_random_expr(const vector<int>& conjs, const vector<Bitset>& F,
     return pool.front().e;
 }
 
+//------------------------------------------------------------------
+// Individuos aleatorios
+//------------------------------------------------------------------
+// Expresión aleatoria con entre 1 y k + 1 conjuntos base (U incluido)
+static Expression expresion_aleatoria(const vector<Bitset>& F, const Bitset& U, int k, mt19937& rng) {
+    // Elegir número aleatorio de conjuntos base a usar
+    int max_sets = min<int>((int)F.size()+1, k+1);
+    int num_conjs = uniform_int_distribution<>(1, max_sets)(rng);
+
+    set<int> usados;
+
+    uniform_int_distribution<> dist_idx(-1, (int)F.size()-1);
+    for (int i = 0; i < num_conjs; ++i)
+        usados.insert(dist_idx(rng));
+
+    vector<int> conjs(usados.begin(), usados.end());
+    return build_random_expr(conjs, F, U, k, rng);
+}
+
+// Individuo evaluado a partir de una expresión
+static Individuo evaluar_individuo(Expression e, const Bitset& G) {
+    Individuo ind;
+    ind.expr    = move(e);
+    ind.jaccard = M(ind.expr, G, Metric::Jaccard);
+    ind.sizeH   = (int)M(ind.expr, G, Metric::SizeH);
+    ind.n_ops   = ind.expr.n_ops;
+    ind.rank    = 0;
+    ind.crowd   = 0.0;
+    return ind;
+}
+
+//------------------------------------------------------------------
+// Bloques base (F_i y U, con U = -1 en used_sets)
+//------------------------------------------------------------------
+vector<SolMO> construir_bloques_base(const vector<Bitset>& F, const Bitset& U, const Bitset& G) {
+    vector<SolMO> bloques_base;
+    bloques_base.reserve(F.size() + 1);
+    for (size_t i = 0; i < F.size(); i++) {
+        set<int> s = {(int)i}; 
+        Expression e(F[i], "F"+to_string(i), s, 0);
+        bloques_base.emplace_back(e, 0, M(e,G,Metric::SizeH), M(e,G,Metric::Jaccard));
+    }
+    set<int> s_u = {-1}; 
+    Expression e_u(U, "U", s_u, 0);
+    bloques_base.emplace_back(e_u, 0, M(e_u,G,Metric::SizeH), M(e_u,G,Metric::Jaccard));
+    return bloques_base;
+}
+
+void puntuar_bloques_base(vector<SolMO>& bloques, const Bitset& G) {
+    for (auto& b : bloques) b.jaccard = M(b.expr, G, Metric::Jaccard);
+}
+
+//------------------------------------------------------------------
+/* Operador memético: escalada sobre una fracción (al azar) de los
+    individuos de rango 0. Las mejoras sustituyen al original si su
+    expresión no está ya en la población. */
+//------------------------------------------------------------------
+static void aplicar_memetica(vector<Individuo>& poblacion, const vector<Bitset>& F, const Bitset& U,
+                             const Bitset& G, const GAParams& params, mt19937& rng) {
+    vector<int> frente0;
+    for (int i = 0; i < (int)poblacion.size(); i++) {
+        if (poblacion[i].rank == 0) frente0.push_back(i);
+    }
+    if (frente0.empty()) return;
+    shuffle(frente0.begin(), frente0.end(), rng);
+    const size_t n = min(frente0.size(), (size_t)ceil(params.memetica_frac * frente0.size()));
+
+    unordered_set<string> vistos;
+    for (const auto& ind : poblacion) vistos.insert(ind.expr.expr_str);
+    for (size_t a = 0; a < n; a++) {
+        Individuo mejor = poblacion[frente0[a]];
+        if (!mejora_local_memetica(mejor, F, U, G, params.memetica_pasos)) continue;
+        if (!vistos.insert(mejor.expr.expr_str).second) continue;
+        mejor.rank = 0;
+        poblacion[frente0[a]] = move(mejor);
+    }
+}
+
+//------------------------------------------------------------------
+// Simplificación de un individuo (el conjunto, y con él el Jaccard, no cambia)
+//------------------------------------------------------------------
+static void simplificar_individuo(Individuo& ind, const vector<Bitset>& F, const Bitset& U, const Bitset& G) {
+    if (simplificar_expresion(ind.expr, F, U)) {
+        ind.n_ops = ind.expr.n_ops;
+        ind.sizeH = (int)M(ind.expr, G, Metric::SizeH);
+    }
+}
+
 //------------------------------------------------------------------
 // NSGA-II
 //------------------------------------------------------------------
@@ -99,8 +193,28 @@ vector<Individuo> nsga2(
     const Bitset& U,
     const Bitset& G,
     int k,
-    const GAParams& params)
+    const GAParams& params,
+    EstadisticasGA* stats)
 {
+    return nsga2_desde(F, U, G, k, params, {}, nullptr, stats);
+}
+
+//------------------------------------------------------------------
+// NSGA-II con población inicial sembrada (arranque en caliente)
+//------------------------------------------------------------------
+vector<Individuo> nsga2_desde(
+    const vector<Bitset>& F,
+    const Bitset& U,
+    const Bitset& G,
+    int k,
+    const GAParams& params,
+    const vector<Individuo>& semillas,
+    vector<Individuo>* poblacion_final,
+    EstadisticasGA* stats,
+    const vector<SolMO>* bloques_precalculados)
+{
+    EstadisticasGA st;
+
     // Semilla: si es 0, usar tiempo actual (no determinista)
     uint64_t seed = params.seed 
         ? params.seed 
@@ -112,19 +226,47 @@ vector<Individuo> nsga2(
     auto time_limit = chrono::seconds(params.time_limit_sec);
 
     // Bloques base para mutación tipo 1
-    vector<SolMO> bloques_base;
-    for (size_t i = 0; i < F.size(); i++) {
-        set<int> s = {(int)i}; 
-        Expression e(F[i], "F"+to_string(i), s, 0);
-        bloques_base.emplace_back(e, 0, M(e,G,Metric::SizeH), M(e,G,Metric::Jaccard));
+    vector<SolMO> propios;
+    if (!bloques_precalculados) propios = construir_bloques_base(F, U, G);
+    const vector<SolMO>& bloques_base = bloques_precalculados ? *bloques_precalculados : propios;
+
+    // Inicializar población: semillas (sin repetir) y el resto aleatorio
+    vector<Individuo> poblacion;
+    if (semillas.empty()) {
+        poblacion = inicializar_poblacion(F, U, G, k, params.population_size, rng,
+                                          MAX_REINTENTOS_INICIAL, &st.duplicados);
+    } else {
+        unordered_set<string> vistos;
+        for (const auto& ind : semillas) {
+            if ((int)poblacion.size() >= params.population_size) break;
+            if (vistos.insert(ind.expr.expr_str).second) {
+                poblacion.push_back(ind);
+                poblacion.back().rank = 0;
+                poblacion.back().crowd = 0.0;
+            }
+        }
+        if ((int)poblacion.size() < params.population_size) {
+            auto resto = inicializar_poblacion(F, U, G, k, params.population_size - (int)poblacion.size(), rng,
+                                               MAX_REINTENTOS_INICIAL, &st.duplicados);
+            for (auto& ind : resto) {
+                if (vistos.insert(ind.expr.expr_str).second) poblacion.push_back(move(ind));
+            }
+        }
     }
-    set<int> s_u = {-1}; 
-    Expression e_u(U, "U", s_u, 0);
-    bloques_base.emplace_back(e_u, 0, M(e_u,G,Metric::SizeH), M(e_u,G,Metric::Jaccard));
 
-    // Inicializar población
-    vector<Individuo> poblacion = inicializar_poblacion(F, U, G, k, params.population_size, rng);
+    // Población inicial simplificada (sin repetir formas canónicas)
+    if (params.simplificar) {
+        unordered_set<string> vistos;
+        vector<Individuo> unicos;
+        unicos.reserve(poblacion.size());
+        for (auto& ind : poblacion) {
+            simplificar_individuo(ind, F, U, G);
+            if (vistos.insert(ind.expr.expr_str).second) unicos.push_back(move(ind));
+        }
+        poblacion = move(unicos);
+    }
 
+    const ReferenciaHV ref_hv = referencia_hv(k, (int)F.size());
     int generation = 0;
     // Bucle principal
     while (generation < params.max_generations && 
@@ -139,26 +281,60 @@ vector<Individuo> nsga2(
         seen_gen.reserve(params.population_size * 2);
         for (const auto& ind : poblacion) seen_gen.insert(ind.expr.expr_str);
 
+        /* Duplicados seguidos: tras max_reintentos se recurre a
+            inmigrantes aleatorios y mutaciones de la población
+            (alternando); tras otros tantos la generación sigue con
+            menos hijos. */
+        int fallos = 0;
         while ((int)offspring.size() < params.population_size) {
-            // Selección por torneo de los dos padres
-            Individuo p1 = torneo_seleccion(poblacion, params.tournament_size, rng);
-            Individuo p2 = torneo_seleccion(poblacion, params.tournament_size, rng);
-
-
             Individuo hijo;
-            // Cruzar
-            if (uniform_real_distribution<>(0,1)(rng) < params.crossover_prob) {
-                hijo = crossover(p1, p2, F, U, G, k, rng);
+            int origen = 0; // 0 = cruce/mutación, 1 = inmigrante, 2 = mutante
+            if (fallos < params.max_reintentos) {
+                // Selección por torneo de los dos padres
+                Individuo p1 = torneo_seleccion(poblacion, params.tournament_size, rng);
+                Individuo p2 = torneo_seleccion(poblacion, params.tournament_size, rng);
+
+                // Cruzar
+                if (uniform_real_distribution<>(0,1)(rng) < params.crossover_prob) {
+                    hijo = crossover(p1, p2, F, U, G, k, rng);
+                } else {
+                    hijo = (uniform_int_distribution<>(0,1)(rng) == 0) ? p1 : p2;
+                }
+                // Mutar
+                if (uniform_real_distribution<>(0,1)(rng) < params.mutation_prob) {
+                    mutar(hijo, F, U, G, k, rng, bloques_base);
+                }
+            } else if (fallos < 2 * params.max_reintentos) {
+                if (fallos % 2 == 0) {
+                    // Inmigrante aleatorio (se evalúa solo si es nuevo)
+                    Expression e = expresion_aleatoria(F, U, k, rng);
+                    if (seen_gen.count(e.expr_str)) {
+                        fallos++;
+                        st.duplicados++;
+                        continue;
+                    }
+                    hijo = evaluar_individuo(move(e), G);
+                    origen = 1;
+                } else {
+                    // Mutación de un individuo de la población
+                    hijo = poblacion[uniform_int_distribution<>(0, (int)poblacion.size() - 1)(rng)];
+                    mutar(hijo, F, U, G, k, rng, bloques_base);
+                    origen = 2;
+                }
             } else {
-                hijo = (uniform_int_distribution<>(0,1)(rng) == 0) ? p1 : p2;
-            }
-            // Mutar
-            if (uniform_real_distribution<>(0,1)(rng) < params.mutation_prob) {
-                mutar(hijo, F, U, G, k, rng, bloques_base);
+                st.huecos_vacios += params.population_size - offspring.size();
+                break;
             }
+            if (params.simplificar) simplificar_individuo(hijo, F, U, G);
             // Añadir hijo si no hemos visto ya esa expresión
             if (seen_gen.insert(hijo.expr.expr_str).second) {
                 offspring.push_back(move(hijo));
+                fallos = 0;
+                if (origen == 1) st.inmigrantes++;
+                if (origen == 2) st.mutantes++;
+            } else {
+                fallos++;
+                st.duplicados++;
             }
         }
 
@@ -190,6 +366,19 @@ vector<Individuo> nsga2(
                 if (Fi.size() <= remaining_capacity) {
                     Pnext.insert(Pnext.end(), Fi.begin(), Fi.end());
                 } 
+                // Si no cabe entero, SMS-EMOA: quitar uno a uno el de menor
+                // contribución al hipervolumen (empates: menor crowding)
+                else if (params.seleccion_hv) {
+                    while (Fi.size() > remaining_capacity) {
+                        vector<double> c = contribuciones_hv(Fi, ref_hv);
+                        size_t peor = 0;
+                        for (size_t a = 1; a < Fi.size(); a++) {
+                            if (c[a] < c[peor] || (c[a] == c[peor] && Fi[a].crowd < Fi[peor].crowd)) peor = a;
+                        }
+                        Fi.erase(Fi.begin() + peor);
+                    }
+                    Pnext.insert(Pnext.end(), Fi.begin(), Fi.end());
+                }
                 // Si el frente Fi no cabe entero, cortar
                 else {
                     // Ordenar por crowding distance descendente
@@ -206,11 +395,20 @@ vector<Individuo> nsga2(
             }
         }
 
+        // Búsqueda local sobre una parte del primer frente
+        if (params.memetica_frac > 0.0) {
+            aplicar_memetica(Pnext, F, U, G, params, rng);
+        }
+
         // Avanzar a la siguiente generación
         poblacion = move(Pnext);
         generation++;
+        if (stats) st.hipervolumen.push_back(hipervolumen(poblacion, ref_hv));
     }
     // Devolver el frente de Pareto final
+    st.generaciones = generation;
+    if (stats) *stats = st;
+    if (poblacion_final) *poblacion_final = poblacion;
     return pareto_front(poblacion);
 }
 
@@ -504,46 +702,28 @@ void mutar(Individuo& ind, const vector<Bitset>& F, const Bitset& U, const Bitse
 // Inicialización aleatoria
 //------------------------------------------------------------------
 vector<Individuo> inicializar_poblacion(const vector<Bitset>& F, const Bitset& U,
-                                        const Bitset& G, int k, int pop_size, mt19937& rng) {
+                                        const Bitset& G, int k, int pop_size, mt19937& rng,
+                                        int max_reintentos, size_t* duplicados) {
     vector<Individuo> pop;
     pop.reserve(pop_size);
 
     unordered_set<string> vistos_expr;
     vistos_expr.reserve(pop_size * 2);
 
-    // Construir individuos aleatorios hasta completar la población
-    while ((int)pop.size() < pop_size) {
-        // Elegir número aleatorio de conjuntos base a usar
-        int max_sets = min<int>((int)F.size()+1, k+1);
-        int num_conjs = uniform_int_distribution<>(1, max_sets)(rng);
-
-        set<int> usados;
-
-        uniform_int_distribution<> dist_idx(-1, (int)F.size()-1);
-        for (int i = 0; i < num_conjs; ++i)
-            usados.insert(dist_idx(rng));
-
-        vector<int> conjs(usados.begin(), usados.end());
-        
-        // Solo continuar si hay conjuntos seleccionados
-        if (!conjs.empty()) { 
-            // Construir expresión aleatoria
-            Expression e = build_random_expr(conjs, F, U, k, rng);
-            auto keyE = e.expr_str;
-            
-            // Solo continuamos si la expresión no ha sido vista antes
-            if (vistos_expr.insert(keyE).second) { 
-                // Construir y añadir el individuo
-                Individuo ind;
-                ind.expr    = move(e);
-                ind.jaccard = M(ind.expr, G, Metric::Jaccard);
-                ind.sizeH   = (int)M(ind.expr, G, Metric::SizeH);
-                ind.n_ops   = ind.expr.n_ops;
-                ind.rank    = 0;
-                ind.crowd   = 0.0;
-
-                pop.push_back(move(ind));
-            }
+    // Construir individuos aleatorios hasta completar la población o
+    // encadenar max_reintentos repetidos (espacio de expresiones agotado)
+    int fallos = 0;
+    while ((int)pop.size() < pop_size && fallos < max_reintentos) {
+        // Construir expresión aleatoria
+        Expression e = expresion_aleatoria(F, U, k, rng);
+
+        // Solo continuamos si la expresión no ha sido vista antes
+        if (vistos_expr.insert(e.expr_str).second) {
+            pop.push_back(evaluar_individuo(move(e), G));
+            fallos = 0;
+        } else {
+            fallos++;
+            if (duplicados) (*duplicados)++;
         }
     }
 
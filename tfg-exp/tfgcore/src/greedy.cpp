@@ -6,6 +6,8 @@
 
 #include "metrics.hpp"
 #include "greedy.hpp"
+#include "muestreo.hpp"
+#include "niveles.hpp"
 #include "solutions.hpp"
 
 #include <algorithm>
@@ -17,21 +19,11 @@
 using namespace std;
 
 // ------------------------------------------------------------------
-// Búsqueda greedy multi-objetivo
+// Bloques base
 // ------------------------------------------------------------------
-vector<SolMO> greedy_multiobjective_search(
-    const vector<Bitset>& F,
-    const Bitset& U,
-    const Bitset& G,
-    int k)
-{
-    // Frente global de soluciones
-    vector<SolMO> frente_global;
-    // Bloques base
+vector<SolMO> bloques_base_greedy(const vector<Bitset>& F, const Bitset& U, const Bitset& G) {
     vector<SolMO> bloques_base;
     bloques_base.reserve(F.size()+1);
-
-    // Generar los bloques base
     for (size_t i = 0; i < F.size(); i++) {
         set<int> sets = {static_cast<int>(i)};
         Expression e(F[i], "F" + to_string(i), sets, 0); 
@@ -44,6 +36,27 @@ vector<SolMO> greedy_multiobjective_search(
     double j_u = M(e_u, G, Metric::Jaccard);
     int sizeH_u = M(e_u, G, Metric::SizeH);
     bloques_base.emplace_back(e_u, 0, sizeH_u, j_u);
+    return bloques_base;
+}
+
+// ------------------------------------------------------------------
+// Búsqueda greedy multi-objetivo
+// ------------------------------------------------------------------
+vector<SolMO> greedy_multiobjective_search(
+    const vector<Bitset>& F,
+    const Bitset& U,
+    const Bitset& G,
+    int k,
+    const PrecribadoGreedy* precribado,
+    EstadisticasPrecribado* stats,
+    const vector<SolMO>* bloques_precalculados)
+{
+    // Frente global de soluciones
+    vector<SolMO> frente_global;
+    // Bloques base (propios si no vienen precalculados)
+    vector<SolMO> propios;
+    if (!bloques_precalculados) propios = bloques_base_greedy(F, U, G);
+    const vector<SolMO>& bloques_base = bloques_precalculados ? *bloques_precalculados : propios;
 
     // Calcular frente de Pareto del nivel 0 (bloques base)
     vector<SolMO> frente_nivel_0 = pareto_front(bloques_base);
@@ -52,45 +65,99 @@ vector<SolMO> greedy_multiobjective_search(
     // Construcción de soluciones de niveles superiores
     vector<SolMO> frente_para_construir = frente_nivel_0;
 
+    // Precribado: muestra y resúmenes de los bloques base (una vez por instancia)
+    EstadisticasPrecribado st;
+    MuestraUniverso muestra;
+    vector<ResumenConjunto> resumenes_base, resumenes_construir;
+    auto resumir_todas = [&](const vector<SolMO>& v) {
+        vector<ResumenConjunto> r;
+        r.reserve(v.size());
+        for (const auto& sol : v) r.push_back(resumir(sol.expr.conjunto, G, muestra));
+        return r;
+    };
+    if (precribado) {
+        muestra = crear_muestra(G, U, precribado->delta, precribado->seed);
+        resumenes_base = resumir_todas(bloques_base);
+        resumenes_construir = resumir_todas(frente_para_construir);
+    }
+
+    const int palabras = palabras_mascara(F.size());
+    const NivelSoA nivel_bloques = nivel_de_soluciones(bloques_base, palabras);
+    const int card_G = (int)G.count();
+
     int s=1; 
     // Mientras queden niveles por construir y no se haya alcanzado k operaciones
     while (s <= k && !frente_para_construir.empty()) {
-        vector<SolMO> candidatos_s;
-        
-        // Generar todas las combinaciones de expresiones con s operaciones
-        for (int op = 0; op < 3; op++) {
-            string op_str = (op == 0) ? " ∪ " : (op == 1) ? " ∩ " : " \\ ";
-            
+        // Candidatas sin expresión: indice = op * |frente| * |bloques| + il * |bloques| + ir
+        const NivelSoA nivel_frente = nivel_de_soluciones(frente_para_construir, palabras);
+        const size_t por_op = nivel_frente.size() * nivel_bloques.size();
+        vector<CandidataNivel> candidatas_s;
+        vector<CandidataNivel> exactos_s; // No dominados entre los evaluados de este nivel (precribado)
+
+        if (!precribado) {
+            // Todas las combinaciones de expresiones con s operaciones
+            candidatas_s.resize(3 * por_op);
+            for (int op = 0; op < 3; op++) {
+                combinar_filas_op(op, nivel_frente, 0, nivel_frente.size(), nivel_bloques, G, card_G, s,
+                                  candidatas_s.data() + op * por_op, nullptr, op * por_op);
+            }
+        }
+        for (int op = 0; op < 3 && precribado; op++) {
             // Combinar cada expresión del frente actual con cada bloque base
-            for (const SolMO& sol_left : frente_para_construir) {
-                for (const SolMO& sol_right : bloques_base) {
-                    
-                    const Expression& left = sol_left.expr;
-                    const Expression& right = sol_right.expr;
-
-                    Bitset new_set;
-                    if (op == 0) new_set = set_union(left.conjunto, right.conjunto);
-                    else if (op == 1) new_set = set_intersect(left.conjunto, right.conjunto);
-                    else new_set = set_difference(left.conjunto, right.conjunto);
-                    
-                    string new_expr = "(" + left.expr_str + op_str + 
-                                     right.expr_str + ")";
-                    
-                    set<int> combined_sets = left.used_sets;
-                    combined_sets.insert(right.used_sets.begin(), right.used_sets.end());
-                    
-                    Expression e_nueva(new_set, new_expr, combined_sets, s); 
-                    
-                    double j = M(e_nueva, G, Metric::Jaccard);
-                    int sizeH = M(e_nueva, G, Metric::SizeH);
-                    
-                    candidatos_s.emplace_back(e_nueva, s, sizeH, j);
+            for (size_t il = 0; il < frente_para_construir.size(); il++) {
+                for (size_t ir = 0; ir < bloques_base.size(); ir++) {
+                    int sizeH = 0;
+                    for (int w = 0; w < palabras; w++) {
+                        sizeH += __builtin_popcountll(nivel_frente.mascara(il)[w] | nivel_bloques.mascara(ir)[w]);
+                    }
+
+                    // Cota superior del Jaccard con los resúmenes y |H| exacto
+                    st.candidatos++;
+                    CandidataNivel optimista;
+                    optimista.jaccard = cota_superior_jaccard(op, resumenes_construir[il], resumenes_base[ir], muestra);
+                    optimista.n_ops = s;
+                    optimista.sizeH = sizeH;
+                    auto dominado = [&](const CandidataNivel& o) { return dominates(o, optimista); };
+                    bool descartar = any_of(exactos_s.begin(), exactos_s.end(), dominado);
+                    for (size_t g = 0; g < frente_global.size() && !descartar; g++) {
+                        const SolMO& sg = frente_global[g];
+                        descartar = dominado(CandidataNivel{sg.jaccard, sg.n_ops, sg.sizeH, 0});
+                    }
+                    if (descartar) {
+                        st.descartados++;
+                        continue;
+                    }
+
+                    CandidataNivel c;
+                    c.jaccard = jaccard_con_cardinal(apply_op(op, nivel_frente.conjuntos[il], nivel_bloques.conjuntos[ir]),
+                                                     G, card_G);
+                    c.n_ops = s;
+                    c.sizeH = sizeH;
+                    c.indice = op * por_op + il * nivel_bloques.size() + ir;
+                    candidatas_s.push_back(c);
+
+                    st.exactos++;
+                    if (none_of(exactos_s.begin(), exactos_s.end(), [&](const CandidataNivel& x) { return dominates(x, c); })) {
+                        exactos_s.erase(remove_if(exactos_s.begin(), exactos_s.end(),
+                            [&](const CandidataNivel& x) { return dominates(c, x); }), exactos_s.end());
+                        exactos_s.push_back(c);
+                    }
                 }
             }
         }
+        contar_evaluaciones(candidatas_s.size());
 
-        // Calcular el frente de Pareto local de las nuevas candidatas
-        vector<SolMO> frente_local_s = pareto_front(candidatos_s);
+        // Expresiones solo para el frente local de las nuevas candidatas
+        vector<SolMO> frente_local_s;
+        for (const auto& c : pareto_front_generic(candidatas_s)) {
+            const int op = (int)(c.indice / por_op);
+            const Expression& left = frente_para_construir[c.indice % por_op / nivel_bloques.size()].expr;
+            const Expression& right = bloques_base[c.indice % nivel_bloques.size()].expr;
+            Expression e(apply_op(op, left.conjunto, right.conjunto),
+                         "(" + left.expr_str + texto_op(op) + right.expr_str + ")", left.used_sets, s);
+            e.used_sets.insert(right.used_sets.begin(), right.used_sets.end());
+            frente_local_s.emplace_back(e, s, c.sizeH, c.jaccard);
+        }
 
         // Combinar el frente global con el local
         vector<SolMO> combined_front = frente_global;
@@ -111,8 +178,10 @@ vector<SolMO> greedy_multiobjective_search(
         // Actualizar el frente global y el frente para construir
         frente_global = std::move(new_global_front);
         frente_para_construir = std::move(frente_siguiente);
+        if (precribado) resumenes_construir = resumir_todas(frente_para_construir);
         s++;
     }
+    if (stats) *stats = st;
     // Devolver el frente global final
     return frente_global;
 }
\ No newline at end of file
@@ -0,0 +1,153 @@
+//----------------------------------------------------------------------
+// hibrido.cpp
+//----------------------------------------------------------------------
+// Tubería híbrida: greedy -> NSGA-II sembrado -> búsqueda local.
+//----------------------------------------------------------------------
+
+#include "hibrido.hpp"
+
+#include <chrono>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_set>
+
+#include "greedy.hpp"
+#include "metrics.hpp"
+
+using namespace std;
+
+static long long ms_desde(chrono::steady_clock::time_point t0) {
+    return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+}
+
+//------------------------------------------------------------------
+// Búsqueda local de Pareto
+//------------------------------------------------------------------
+vector<Individuo> busqueda_local(const vector<Individuo>& frente, const vector<Individuo>& companeros,
+                                 const vector<Bitset>& F,
+                                 const Bitset& U, const Bitset& G, int k, int max_rondas,
+                                 size_t max_evaluaciones, EstadisticasHibrido* stats) {
+    const vector<SolMO> bloques_base = construir_bloques_base(F, U, G);
+
+    // Archivo inicial sin expresiones repetidas
+    unordered_set<string> vistos;
+    vector<Individuo> archivo;
+    for (const auto& ind : frente) {
+        if (vistos.insert(ind.expr.expr_str).second) archivo.push_back(ind);
+    }
+    archivo = pareto_front(archivo);
+    vector<Individuo> nuevos = archivo;
+
+    size_t evaluaciones = 0, mejoras = 0;
+
+    // Evalúa (a op b) salvo que ya se haya visto o se agote el presupuesto
+    vector<Individuo> vecinos;
+    auto probar = [&](const SolMO& a, const SolMO& b, int op) {
+        if (evaluaciones >= max_evaluaciones) return;
+        const char* op_str = texto_op(op);
+        string expr_str = "(" + a.expr.expr_str + op_str + b.expr.expr_str + ")";
+        if (!vistos.insert(expr_str).second) return;
+
+        set<int> usados = a.expr.used_sets;
+        usados.insert(b.expr.used_sets.begin(), b.expr.used_sets.end());
+        const int n_ops = a.n_ops + b.n_ops + 1;
+        Expression e(apply_op(op, a.expr.conjunto, b.expr.conjunto), expr_str, usados, n_ops);
+        double j = M(e, G, Metric::Jaccard);
+        int sizeH = (int)M(e, G, Metric::SizeH);
+        vecinos.emplace_back(e, n_ops, sizeH, j);
+        evaluaciones++;
+    };
+
+    for (int ronda = 0; ronda < max_rondas && !nuevos.empty() && evaluaciones < max_evaluaciones; ronda++) {
+        vecinos.clear();
+        for (const auto& s : nuevos) {
+            // Extensión con un bloque base más (a ambos lados)
+            if (s.n_ops < k) {
+                for (const auto& b : bloques_base) {
+                    for (int op = 0; op < 3; op++) {
+                        probar(s, b, op);
+                        probar(b, s, op);
+                    }
+                }
+            }
+            // Combinación con el resto del frente y con los compañeros
+            const vector<Individuo>* grupos[] = {&archivo, &companeros};
+            for (const auto* grupo : grupos) {
+                for (const auto& t : *grupo) {
+                    if (s.n_ops + t.n_ops + 1 > k || s.expr.expr_str == t.expr.expr_str) continue;
+                    for (int op = 0; op < 3; op++) {
+                        probar(s, t, op);
+                        probar(t, s, op);
+                    }
+                }
+            }
+        }
+
+        // Nuevo archivo: solo los vecinos no dominados pasan a la siguiente ronda
+        unordered_set<string> en_archivo;
+        for (const auto& ind : archivo) en_archivo.insert(ind.expr.expr_str);
+        archivo.insert(archivo.end(), vecinos.begin(), vecinos.end());
+        archivo = pareto_front(archivo);
+
+        nuevos.clear();
+        for (const auto& ind : archivo) {
+            if (!en_archivo.count(ind.expr.expr_str)) nuevos.push_back(ind);
+        }
+        mejoras += nuevos.size();
+    }
+
+    if (stats) {
+        stats->evaluaciones_local += evaluaciones;
+        stats->mejoras_local += mejoras;
+    }
+    return archivo;
+}
+
+//------------------------------------------------------------------
+// Tubería completa
+//------------------------------------------------------------------
+vector<Individuo> hibrido(const vector<Bitset>& F, const Bitset& U, const Bitset& G, int k,
+                          const HibridoParams& params, EstadisticasHibrido* stats) {
+    EstadisticasHibrido st;
+
+    // 1. Greedy
+    auto t0 = chrono::steady_clock::now();
+    vector<SolMO> frente_greedy = greedy_multiobjective_search(F, U, G, k);
+    st.ms_greedy = ms_desde(t0);
+
+    // 2. Semillas: el frente greedy y mutaciones de cada solución
+    t0 = chrono::steady_clock::now();
+    uint64_t semilla = params.ga.seed
+        ? params.ga.seed
+        : (uint64_t)chrono::high_resolution_clock::now().time_since_epoch().count();
+    mt19937 rng(semilla + 1);
+    const vector<SolMO> bloques_base = construir_bloques_base(F, U, G);
+
+    vector<Individuo> semillas(frente_greedy.begin(), frente_greedy.end());
+    for (const auto& s : frente_greedy) {
+        for (int m = 0; m < params.mutantes_por_semilla; m++) {
+            Individuo mutante(s);
+            mutar(mutante, F, U, G, k, rng, bloques_base);
+            semillas.push_back(move(mutante));
+        }
+    }
+    st.semillas = semillas.size();
+
+    GAParams ga = params.ga;
+    ga.seed = semilla;
+    vector<Individuo> poblacion;
+    vector<Individuo> frente = nsga2_desde(F, U, G, k, ga, semillas, &poblacion);
+    st.ms_genetico = ms_desde(t0);
+
+    // 3. Búsqueda local sobre el frente del genético y el del greedy,
+    //    combinando también con la última población
+    t0 = chrono::steady_clock::now();
+    frente.insert(frente.end(), frente_greedy.begin(), frente_greedy.end());
+    frente = busqueda_local(frente, poblacion, F, U, G, k, params.max_rondas_local,
+                            params.max_evaluaciones_local, &st);
+    st.ms_local = ms_desde(t0);
+
+    if (stats) *stats = st;
+    return frente;
+}
@@ -0,0 +1,307 @@
+//----------------------------------------------------------------------
+// incremental.cpp
+//----------------------------------------------------------------------
+// Re-resolución incremental cuando cambia la familia F.
+//----------------------------------------------------------------------
+
+#include "incremental.hpp"
+
+#include <cctype>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "metrics.hpp"
+
+using namespace std;
+
+//------------------------------------------------------------------
+// Bloques base (mismos valores que greedy_multiobjective_search)
+//------------------------------------------------------------------
+static SolMO crear_bloque(const Bitset& conjunto, const string& nombre, const set<int>& usados, const Bitset& G) {
+    Expression e(conjunto, nombre, usados, 0);
+    double j = M(e, G, Metric::Jaccard);
+    int sizeH = M(e, G, Metric::SizeH);
+    return SolMO(e, 0, sizeH, j);
+}
+
+EstadoGreedy greedy_estado_inicial(const vector<Bitset>& F, const Bitset& U, const Bitset& G, int k) {
+    EstadoGreedy e;
+    e.U = U;
+    e.G = G;
+    e.k = k;
+    e.F = F;
+    e.activo.assign(F.size(), 1);
+    for (size_t i = 0; i < F.size(); i++) {
+        e.bloques.push_back(crear_bloque(F[i], "F" + to_string(i), {(int)i}, G));
+    }
+    e.bloque_U = crear_bloque(U, "U", {}, G);
+    return e;
+}
+
+//------------------------------------------------------------------
+// Cambios e invalidación
+//------------------------------------------------------------------
+ResumenCambios aplicar_cambios(EstadoGreedy& estado, const vector<CambioF>& cambios) {
+    // Índices compactos antes de los cambios
+    vector<int> ids_previos;
+    for (int id = 0; id < (int)estado.F.size(); id++) {
+        if (estado.activo[id]) ids_previos.push_back(id);
+    }
+    const int num_ids_previos = (int)estado.F.size();
+
+    ResumenCambios r;
+    vector<char> cambiado(estado.F.size(), 0);
+    for (const auto& c : cambios) {
+        if (c.tipo == CambioF::Anadir) {
+            int id = (int)estado.F.size();
+            estado.F.push_back(c.conjunto);
+            estado.activo.push_back(1);
+            estado.bloques.push_back(crear_bloque(c.conjunto, "F" + to_string(id), {id}, estado.G));
+            cambiado.push_back(1);
+            r.anadidos.push_back(id);
+            continue;
+        }
+        if (c.id < 0 || c.id >= (int)estado.F.size() || !estado.activo[c.id]) {
+            throw invalid_argument("Id de conjunto inválido: " + to_string(c.id));
+        }
+        cambiado[c.id] = 1;
+        if (c.tipo == CambioF::Eliminar) {
+            estado.activo[c.id] = 0;
+        } else {
+            estado.F[c.id] = c.conjunto;
+            estado.bloques[c.id] = crear_bloque(c.conjunto, "F" + to_string(c.id), {c.id}, estado.G);
+        }
+    }
+
+    // Invalidar: se descartan las izquierdas que usan un conjunto cambiado
+    // y, en las demás, solo los hijos cuyo bloque derecho cambió
+    for (int id = 0; id < num_ids_previos; id++) {
+        if (!cambiado[id]) continue;
+        for (auto& nivel : estado.niveles) {
+            for (auto it = nivel.begin(); it != nivel.end();) {
+                if (it->second.usados_izq.count(id)) {
+                    it = nivel.erase(it);
+                    continue;
+                }
+                for (auto& v : it->second.valido) {
+                    if ((size_t)id + 1 < v.size()) v[id + 1] = 0;
+                }
+                ++it;
+            }
+        }
+    }
+
+    // Correspondencia de índices compactos
+    vector<int> compacto(estado.F.size(), -1);
+    for (int id = 0, c = 0; id < (int)estado.F.size(); id++) {
+        if (estado.activo[id]) compacto[id] = c++;
+    }
+    for (int id : ids_previos) {
+        r.mapa.push_back(compacto[id]);
+        r.tocado.push_back(cambiado[id] && estado.activo[id]);
+    }
+
+    if (!cambios.empty()) estado.sucio = true;
+    return r;
+}
+
+vector<Bitset> familia_actual(const EstadoGreedy& estado) {
+    vector<Bitset> F;
+    for (size_t id = 0; id < estado.F.size(); id++) {
+        if (estado.activo[id]) F.push_back(estado.F[id]);
+    }
+    return F;
+}
+
+//------------------------------------------------------------------
+// Greedy con caché (mismo orden de candidatos que el greedy original,
+// así el frente coincide con el de una ejecución completa)
+//------------------------------------------------------------------
+const vector<SolMO>& greedy_incremental(EstadoGreedy& estado) {
+    if (!estado.sucio) return estado.frente;
+    estado.evaluadas = 0;
+    estado.reutilizadas = 0;
+
+    // Bloques base: F activos en orden de id y U al final
+    vector<const SolMO*> bloques_base;
+    vector<int> huecos;
+    vector<int> compacto(estado.F.size(), -1);
+    for (int id = 0; id < (int)estado.F.size(); id++) {
+        if (!estado.activo[id]) continue;
+        compacto[id] = (int)bloques_base.size();
+        bloques_base.push_back(&estado.bloques[id]);
+        huecos.push_back(id + 1);
+    }
+    bloques_base.push_back(&estado.bloque_U);
+    huecos.push_back(0);
+    const size_t num_huecos = estado.F.size() + 1;
+    const size_t nb = bloques_base.size();
+
+    // Conjuntos y máscaras de los bloques (máscaras por id estable)
+    const int palabras = palabras_mascara(estado.F.size());
+    NivelSoA nivel_bloques;
+    nivel_bloques.palabras = palabras;
+    nivel_bloques.redimensionar(nb);
+    vector<CandidataNivel> candidatas_0(nb);
+    for (size_t b = 0; b < nb; b++) {
+        const SolMO& bloque = *bloques_base[b];
+        nivel_bloques.conjuntos[b] = bloque.expr.conjunto;
+        for (int f : bloque.expr.used_sets) nivel_bloques.mascaras[b * palabras + f / 64] |= 1ull << (f % 64);
+        candidatas_0[b] = CandidataNivel{bloque.jaccard, 0, bloque.sizeH, b};
+    }
+    const int card_G = (int)estado.G.count();
+
+    // Frente del nivel 0 (solo se copian los bloques que llegan a él)
+    vector<SolMO> frente_global;
+    for (const auto& c : pareto_front_generic(candidatas_0)) frente_global.push_back(*bloques_base[c.indice]);
+    vector<SolMO> frente_para_construir = frente_global;
+    if ((int)estado.niveles.size() < estado.k) estado.niveles.resize(max(0, estado.k));
+
+    int s = 1;
+    while (s <= estado.k && !frente_para_construir.empty()) {
+        auto& cache = estado.niveles[s - 1];
+
+        // Hijos de cada expresión izquierda (solo se conservan las del frente actual)
+        for (auto& e : cache) e.second.en_frente = false;
+        vector<EstadoGreedy::Hijos*> hijos;
+        vector<char> sin_cache;
+        hijos.reserve(frente_para_construir.size());
+        sin_cache.reserve(frente_para_construir.size());
+        for (const auto& izq : frente_para_construir) {
+            auto ins = cache.try_emplace(izq.expr.expr_str);
+            auto& h = ins.first->second;
+            sin_cache.push_back(ins.second);
+            if (ins.second) h.usados_izq = izq.expr.used_sets;
+            h.en_frente = true;
+            for (int op = 0; op < 3; op++) {
+                if (h.cand[op].size() < num_huecos) {
+                    h.cand[op].resize(num_huecos);
+                    h.valido[op].resize(num_huecos, 0);
+                }
+            }
+            hijos.push_back(&h);
+        }
+
+        // Candidatas sin expresión: indice = op * |frente| * |bloques| + il * |bloques| + ir
+        const NivelSoA nivel_frente = nivel_de_soluciones(frente_para_construir, palabras);
+        const size_t por_op = nivel_frente.size() * nb;
+        vector<CandidataNivel> candidatas_s(3 * por_op);
+        size_t evaluadas_s = 0;
+
+        // Izquierdas sin caché: filas consecutivas con el núcleo por pares
+        for (size_t f0 = 0; f0 < nivel_frente.size();) {
+            if (!sin_cache[f0]) { f0++; continue; }
+            size_t f1 = f0;
+            while (f1 < nivel_frente.size() && sin_cache[f1]) f1++;
+            for (int op = 0; op < 3; op++) {
+                combinar_filas_op(op, nivel_frente, f0, f1, nivel_bloques, estado.G, card_G, s,
+                                  candidatas_s.data() + op * por_op + f0 * nb, nullptr, op * por_op);
+            }
+            evaluadas_s += 3 * (f1 - f0) * nb;
+            f0 = f1;
+        }
+
+        for (int op = 0; op < 3; op++) {
+            for (size_t li = 0; li < nivel_frente.size(); li++) {
+                auto& h = *hijos[li];
+                CandidataNivel* fila = candidatas_s.data() + op * por_op + li * nb;
+                for (size_t bj = 0; bj < nb; bj++) {
+                    const int hueco = huecos[bj];
+                    CandidataNivel& c = fila[bj];
+                    if (sin_cache[li]) {
+                        h.cand[op][hueco] = c;
+                        h.valido[op][hueco] = 1;
+                        continue;
+                    }
+                    if (h.valido[op][hueco]) {
+                        c = h.cand[op][hueco];
+                        c.indice = op * por_op + li * nb + bj;
+                        estado.reutilizadas++;
+                        continue;
+                    }
+                    // Hijo invalidado por un cambio en el bloque derecho
+                    int sizeH = 0;
+                    for (int w = 0; w < palabras; w++) {
+                        sizeH += __builtin_popcountll(nivel_frente.mascara(li)[w] | nivel_bloques.mascara(bj)[w]);
+                    }
+                    c.jaccard = jaccard_con_cardinal(apply_op(op, nivel_frente.conjuntos[li], nivel_bloques.conjuntos[bj]),
+                                                     estado.G, card_G);
+                    c.n_ops = s;
+                    c.sizeH = sizeH;
+                    c.indice = op * por_op + li * nb + bj;
+                    h.cand[op][hueco] = c;
+                    h.valido[op][hueco] = 1;
+                    evaluadas_s++;
+                }
+            }
+        }
+        for (auto it = cache.begin(); it != cache.end();) {
+            it = it->second.en_frente ? next(it) : cache.erase(it);
+        }
+        contar_evaluaciones(evaluadas_s);
+        estado.evaluadas += evaluadas_s;
+
+        // Expresiones solo para el frente local (como greedy_multiobjective_search)
+        vector<SolMO> frente_local_s;
+        for (const auto& c : pareto_front_generic(candidatas_s)) {
+            const int op = (int)(c.indice / por_op);
+            const Expression& left = frente_para_construir[c.indice % por_op / nb].expr;
+            const Expression& right = bloques_base[c.indice % nb]->expr;
+            Expression e(apply_op(op, left.conjunto, right.conjunto),
+                         "(" + left.expr_str + texto_op(op) + right.expr_str + ")", left.used_sets, s);
+            e.used_sets.insert(right.used_sets.begin(), right.used_sets.end());
+            frente_local_s.emplace_back(e, s, c.sizeH, c.jaccard);
+        }
+
+        // Mismo ensamblado de frentes que greedy_multiobjective_search
+        vector<SolMO> combined_front = frente_global;
+        combined_front.insert(combined_front.end(), frente_local_s.begin(), frente_local_s.end());
+        vector<SolMO> new_global_front = pareto_front(combined_front);
+
+        vector<SolMO> frente_siguiente;
+        for (const auto& sol : new_global_front) {
+            if (sol.expr.n_ops == s) frente_siguiente.push_back(sol);
+        }
+        frente_global = move(new_global_front);
+        frente_para_construir = move(frente_siguiente);
+        s++;
+    }
+
+    // Nombres compactos en el resultado
+    estado.frente = move(frente_global);
+    for (auto& sol : estado.frente) renombrar_conjuntos(sol.expr, compacto);
+    estado.sucio = false;
+    return estado.frente;
+}
+
+//------------------------------------------------------------------
+// Renombrado de conjuntos
+//------------------------------------------------------------------
+bool renombrar_conjuntos(Expression& e, const vector<int>& mapa) {
+    string r;
+    r.reserve(e.expr_str.size());
+    const string& s = e.expr_str;
+    for (size_t p = 0; p < s.size();) {
+        if (s[p] == 'F' && p + 1 < s.size() && isdigit((unsigned char)s[p + 1])) {
+            size_t q = p + 1;
+            int i = 0;
+            while (q < s.size() && isdigit((unsigned char)s[q])) i = i * 10 + (s[q++] - '0');
+            if (i >= (int)mapa.size() || mapa[i] < 0) return false;
+            r += 'F';
+            r += to_string(mapa[i]);
+            p = q;
+        } else {
+            r += s[p++];
+        }
+    }
+    set<int> usados;
+    for (int i : e.used_sets) {
+        if (i < 0) usados.insert(i);
+        else if (i < (int)mapa.size() && mapa[i] >= 0) usados.insert(mapa[i]);
+        else return false;
+    }
+    e.expr_str = move(r);
+    e.used_sets = move(usados);
+    return true;
+}
@@ -0,0 +1,366 @@
+//----------------------------------------------------------------------
+// instance_io.cpp
+//----------------------------------------------------------------------
+// Formato binario de instancias (versionado, mapeable en memoria)
+// y conversión desde el volcado de texto de print_conjuntos.
+//----------------------------------------------------------------------
+
+#include "instance_io.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+//------------------------------------------------------------------
+// Conversión Bitset <-> palabras
+//------------------------------------------------------------------
+vector<uint64_t> bitset_a_palabras(const Bitset& b, uint64_t universo) {
+    universo = min(universo, (uint64_t)U_size);
+    vector<uint64_t> w(palabras_para(universo), 0);
+    for (uint64_t i = 0; i < universo; i++) {
+        if (b[i]) w[i / 64] |= (uint64_t)1 << (i % 64);
+    }
+    return w;
+}
+
+Bitset palabras_a_bitset(const uint64_t* w, uint64_t universo) {
+    if (universo > (uint64_t)U_size) {
+        throw invalid_argument("Universo de la instancia (" + to_string(universo) +
+                               ") mayor que U_size (" + to_string(U_size) + ")");
+    }
+    Bitset b;
+    for (uint64_t i = 0; i < universo; i++) {
+        if ((w[i / 64] >> (i % 64)) & 1) b[i] = 1;
+    }
+    return b;
+}
+
+Bitset universo_hasta(uint64_t universo) {
+    if (universo > (uint64_t)U_size) {
+        throw invalid_argument("Universo de la instancia (" + to_string(universo) +
+                               ") mayor que U_size (" + to_string(U_size) + ")");
+    }
+    Bitset U;
+    for (uint64_t i = 0; i < universo; i++) U[i] = 1;
+    return U;
+}
+
+//------------------------------------------------------------------
+// Escritura
+//------------------------------------------------------------------
+void guardar_instancia_empaquetada(const string& path,
+                                   uint64_t universo,
+                                   const vector<uint64_t>& G,
+                                   const vector<vector<uint64_t>>& F,
+                                   const GoldGuardado* gold,
+                                   uint64_t seed)
+{
+    const uint64_t wpc = palabras_para(universo);
+    if (G.size() != wpc) throw invalid_argument("G no tiene el número de palabras esperado");
+    for (const auto& Fi : F) {
+        if (Fi.size() != wpc) throw invalid_argument("F_i no tiene el número de palabras esperado");
+    }
+
+    CabeceraInstancia cab{};
+    memcpy(cab.magic, INSTANCIA_MAGIC, sizeof(cab.magic));
+    cab.version = INSTANCIA_VERSION;
+    cab.flags = gold ? INSTANCIA_CON_GOLD : 0;
+    cab.universo = universo;
+    cab.num_F = F.size();
+    cab.palabras_por_conjunto = wpc;
+    cab.seed = seed;
+    cab.offset_gold = gold ? sizeof(CabeceraInstancia) + (F.size() + 1) * wpc * sizeof(uint64_t) : 0;
+
+    ofstream out(path, ios::binary | ios::trunc);
+    if (!out) throw runtime_error("No se pudo crear " + path);
+
+    out.write(reinterpret_cast<const char*>(&cab), sizeof(cab));
+    out.write(reinterpret_cast<const char*>(G.data()), wpc * sizeof(uint64_t));
+    for (const auto& Fi : F) {
+        out.write(reinterpret_cast<const char*>(Fi.data()), wpc * sizeof(uint64_t));
+    }
+
+    // Sección gold
+    if (gold) {
+        int32_t n_ops = gold->n_ops;
+        uint32_t num_usados = (uint32_t)gold->used_sets.size();
+        uint32_t longitud = (uint32_t)gold->expr_str.size();
+        out.write(reinterpret_cast<const char*>(&n_ops), sizeof(n_ops));
+        out.write(reinterpret_cast<const char*>(&num_usados), sizeof(num_usados));
+        for (int u : gold->used_sets) {
+            int32_t v = u;
+            out.write(reinterpret_cast<const char*>(&v), sizeof(v));
+        }
+        out.write(reinterpret_cast<const char*>(&longitud), sizeof(longitud));
+        out.write(gold->expr_str.data(), longitud);
+    }
+
+    if (!out) throw runtime_error("Error al escribir " + path);
+}
+
+void guardar_instancia_empaquetada(const string& path,
+                                   const InstanciaEmpaquetada& inst)
+{
+    guardar_instancia_empaquetada(path, inst.universo, inst.G, inst.F, nullptr, inst.seed);
+}
+
+void guardar_instancia(const string& path,
+                       const vector<Bitset>& F,
+                       const Bitset& G,
+                       const Expression* gold,
+                       uint64_t seed,
+                       uint64_t universo)
+{
+    universo = min(universo, (uint64_t)U_size);
+    vector<vector<uint64_t>> F_w;
+    F_w.reserve(F.size());
+    for (const auto& Fi : F) F_w.push_back(bitset_a_palabras(Fi, universo));
+
+    GoldGuardado g;
+    if (gold) {
+        g.expr_str = gold->expr_str;
+        g.used_sets.assign(gold->used_sets.begin(), gold->used_sets.end());
+        g.n_ops = gold->n_ops;
+    }
+    guardar_instancia_empaquetada(path, universo, bitset_a_palabras(G, universo), F_w,
+                                  gold ? &g : nullptr, seed);
+}
+
+//------------------------------------------------------------------
+// Lectura mapeada en memoria
+//------------------------------------------------------------------
+InstanciaMapeada::InstanciaMapeada(const string& path) {
+#if !defined(_WIN32)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw runtime_error("No se pudo abrir " + path);
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(CabeceraInstancia)) {
+        ::close(fd);
+        throw runtime_error("Fichero de instancia inválido: " + path);
+    }
+    tam_ = (size_t)st.st_size;
+    base_ = ::mmap(nullptr, tam_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (base_ == MAP_FAILED) {
+        base_ = nullptr;
+        throw runtime_error("No se pudo mapear " + path);
+    }
+    mapeado_ = true;
+#else
+    // Sin mmap: leer el fichero completo
+    ifstream in(path, ios::binary);
+    if (!in) throw runtime_error("No se pudo abrir " + path);
+    copia_.assign(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+    tam_ = copia_.size();
+    if (tam_ < sizeof(CabeceraInstancia)) throw runtime_error("Fichero de instancia inválido: " + path);
+    base_ = copia_.data();
+#endif
+
+    cab_ = static_cast<const CabeceraInstancia*>(base_);
+    datos_ = reinterpret_cast<const uint64_t*>(static_cast<const char*>(base_) + sizeof(CabeceraInstancia));
+
+    // Validar cabecera y tamaño
+    string error;
+    if (memcmp(cab_->magic, INSTANCIA_MAGIC, sizeof(INSTANCIA_MAGIC)) != 0) error = "firma incorrecta";
+    else if (cab_->version == 0 || cab_->version > INSTANCIA_VERSION) error = "versión no soportada";
+    else if (cab_->universo > UINT64_MAX - 63 || cab_->palabras_por_conjunto != palabras_para(cab_->universo))
+        error = "cabecera incoherente";
+    // (num_F + 1) * palabras <= palabras disponibles, sin multiplicar (cabecera manipulada)
+    else if (cab_->palabras_por_conjunto > 0 &&
+             cab_->num_F >= (tam_ - sizeof(CabeceraInstancia)) / sizeof(uint64_t) / cab_->palabras_por_conjunto)
+        error = "fichero truncado";
+    else if (tiene_gold() && cab_->offset_gold > tam_ - 2 * sizeof(uint32_t)) error = "sección gold truncada";
+
+    if (!error.empty()) {
+#if !defined(_WIN32)
+        ::munmap(base_, tam_);
+#endif
+        base_ = nullptr;
+        throw runtime_error("Instancia " + path + ": " + error);
+    }
+}
+
+InstanciaMapeada::~InstanciaMapeada() {
+#if !defined(_WIN32)
+    if (mapeado_ && base_) ::munmap(base_, tam_);
+#endif
+}
+
+GoldGuardado InstanciaMapeada::gold() const {
+    GoldGuardado g;
+    if (!tiene_gold()) return g;
+
+    const char* p = static_cast<const char*>(base_) + cab_->offset_gold;
+    const char* fin = static_cast<const char*>(base_) + tam_;
+    auto leer = [&](void* dst, size_t n) {
+        if (n > (size_t)(fin - p)) throw runtime_error("Sección gold truncada");
+        memcpy(dst, p, n);
+        p += n;
+    };
+
+    int32_t n_ops = 0;
+    uint32_t num_usados = 0, longitud = 0;
+    leer(&n_ops, sizeof(n_ops));
+    leer(&num_usados, sizeof(num_usados));
+    g.used_sets.resize(num_usados);
+    for (uint32_t i = 0; i < num_usados; i++) {
+        int32_t v;
+        leer(&v, sizeof(v));
+        g.used_sets[i] = v;
+    }
+    leer(&longitud, sizeof(longitud));
+    g.expr_str.resize(longitud);
+    if (longitud) leer(&g.expr_str[0], longitud);
+    g.n_ops = n_ops;
+    return g;
+}
+
+//------------------------------------------------------------------
+// Carga completa como GroundTruthInstance
+//------------------------------------------------------------------
+GroundTruthInstance cargar_instancia(const string& path, uint64_t* universo) {
+    InstanciaMapeada m(path);
+    if (universo) *universo = m.universo();
+
+    GroundTruthInstance inst;
+    inst.F.reserve(m.num_F());
+    for (size_t i = 0; i < m.num_F(); i++) inst.F.push_back(palabras_a_bitset(m.F(i), m.universo()));
+    inst.G = palabras_a_bitset(m.G(), m.universo());
+    inst.seed = m.seed();
+
+    if (m.tiene_gold()) {
+        GoldGuardado g = m.gold();
+        set<int> usados(g.used_sets.begin(), g.used_sets.end());
+        inst.gold_expr = Expression(inst.G, g.expr_str, usados, g.n_ops);
+    }
+    return inst;
+}
+
+//------------------------------------------------------------------
+// Conversión desde el volcado de texto
+//------------------------------------------------------------------
+// Lista de elementos "1,5,7," -> índices
+static vector<uint64_t> parsear_elementos(const string& s) {
+    vector<uint64_t> r;
+    stringstream ss(s);
+    string tok;
+    while (getline(ss, tok, ',')) {
+        size_t a = tok.find_first_not_of(" \t\r");
+        if (a == string::npos) continue;
+        r.push_back(stoull(tok.substr(a)));
+    }
+    return r;
+}
+
+vector<Bitset> cargar_objetivos(const string& path, uint64_t universo) {
+    ifstream in(path);
+    if (!in) throw runtime_error("No se pudo abrir " + path);
+    universo = min(universo, (uint64_t)U_size);
+
+    vector<Bitset> Gs;
+    string linea;
+    for (int num = 1; getline(in, linea); num++) {
+        linea = linea.substr(0, linea.find('#'));
+        if (linea.find_first_not_of(" \t\r") == string::npos) continue;
+        Bitset G;
+        for (uint64_t x : parsear_elementos(linea)) {
+            if (x >= universo) {
+                throw invalid_argument(path + ":" + to_string(num) + ": elemento fuera del universo (" +
+                                       to_string(x) + ")");
+            }
+            G[x] = 1;
+        }
+        Gs.push_back(G);
+    }
+    return Gs;
+}
+
+// Índices F<i> usados en una expresión y número de operaciones
+static void analizar_expresion(const string& e, vector<int>& usados, int& n_ops) {
+    set<int> u;
+    n_ops = 0;
+    for (size_t i = 0; i < e.size(); i++) {
+        if (e[i] == '(') n_ops++;
+        if (e[i] == 'F' && i + 1 < e.size() && isdigit((unsigned char)e[i + 1])) {
+            size_t j = i + 1;
+            while (j < e.size() && isdigit((unsigned char)e[j])) j++;
+            u.insert(stoi(e.substr(i + 1, j - i - 1)));
+            i = j - 1;
+        }
+    }
+    usados.assign(u.begin(), u.end());
+}
+
+void convertir_texto_a_binario(const string& path_texto, const string& path_binario) {
+    ifstream in(path_texto);
+    if (!in) throw runtime_error("No se pudo abrir " + path_texto);
+
+    uint64_t universo = 0, seed = 0, max_elem = 0;
+    bool hay_G = false;
+    vector<uint64_t> elems_G;
+    vector<vector<uint64_t>> elems_F;
+    GoldGuardado gold;
+    bool hay_gold = false;
+
+    auto valor = [](const string& linea) {
+        string v = linea.substr(linea.find(':') + 1);
+        size_t a = v.find_first_not_of(" \t");
+        size_t b = v.find_last_not_of(" \t\r");
+        return (a == string::npos) ? string() : v.substr(a, b - a + 1);
+    };
+
+    string linea;
+    while (getline(in, linea)) {
+        if (linea.rfind("Semilla:", 0) == 0) seed = stoull(valor(linea));
+        else if (linea.rfind("U_size:", 0) == 0) universo = stoull(valor(linea));
+        else if (linea.rfind("Expresion de referencia:", 0) == 0) {
+            gold.expr_str = valor(linea);
+            analizar_expresion(gold.expr_str, gold.used_sets, gold.n_ops);
+            hay_gold = true;
+        }
+        else if (linea.rfind("CONJUNTO_G:", 0) == 0 && !hay_G) {
+            elems_G = parsear_elementos(valor(linea));
+            hay_G = true;
+        }
+        else if (hay_G && linea.size() > 1 && linea[0] == 'F' && isdigit((unsigned char)linea[1])) {
+            size_t dp = linea.find(':');
+            if (dp == string::npos) continue;
+            size_t idx = stoul(linea.substr(1, dp - 1));
+            if (idx != elems_F.size()) continue; // solo el primer bloque de conjuntos
+            elems_F.push_back(parsear_elementos(valor(linea)));
+        }
+    }
+    if (!hay_G) throw runtime_error("No se encontró CONJUNTO_G en " + path_texto);
+
+    // Universo: U_size declarado o, si falta, el mayor elemento + 1
+    for (uint64_t x : elems_G) max_elem = max(max_elem, x + 1);
+    for (const auto& Fi : elems_F) for (uint64_t x : Fi) max_elem = max(max_elem, x + 1);
+    if (universo < max_elem) universo = max_elem;
+
+    const uint64_t wpc = palabras_para(universo);
+    auto empaquetar = [wpc](const vector<uint64_t>& elems) {
+        vector<uint64_t> w(wpc, 0);
+        for (uint64_t x : elems) w[x / 64] |= (uint64_t)1 << (x % 64);
+        return w;
+    };
+
+    vector<vector<uint64_t>> F_w;
+    F_w.reserve(elems_F.size());
+    for (const auto& Fi : elems_F) F_w.push_back(empaquetar(Fi));
+
+    guardar_instancia_empaquetada(path_binario, universo, empaquetar(elems_G), F_w,
+                                  hay_gold ? &gold : nullptr, seed);
+}
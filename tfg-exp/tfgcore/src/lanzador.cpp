@@ -0,0 +1,123 @@
+//------------------------------------------------------------------
+// lanzador.cpp
+//------------------------------------------------------------------
+// Elige, para el universo de la instancia, el ejecutable precompilado
+// más pequeño de la escalera de anchos (main_u<ancho>) y lo ejecuta
+// con los mismos argumentos. Por encima del último ancho usa el
+// ejecutable con conjuntos comprimidos (main_comprimido).
+//
+// Universo:  --instance p   el de la cabecera de la instancia
+//            --universo n   explícito (incompatible con --instance)
+//            en otro caso   TFG_U_DEFECTO (el U_SIZE de main)
+//
+// Sin instancia el universo se pasa a main como --universo, para que
+// la instancia generada no dependa del ancho elegido.
+//------------------------------------------------------------------
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "instance_io.hpp"
+
+using namespace std;
+
+#ifndef TFG_ANCHOS_LISTA
+#define TFG_ANCHOS_LISTA "64,128,256,512,1024,4096"
+#endif
+#ifndef TFG_U_MAX
+#define TFG_U_MAX 1048576
+#endif
+#ifndef TFG_U_DEFECTO
+#define TFG_U_DEFECTO 128
+#endif
+
+static vector<uint64_t> leer_anchos() {
+    vector<uint64_t> anchos;
+    stringstream ss(TFG_ANCHOS_LISTA);
+    string a;
+    while (getline(ss, a, ',')) anchos.push_back(stoull(a));
+    sort(anchos.begin(), anchos.end());
+    return anchos;
+}
+
+static uint64_t universo_de_instancia(const string& path) {
+    ifstream in(path, ios::binary);
+    CabeceraInstancia cab;
+    if (!in.read(reinterpret_cast<char*>(&cab), sizeof(cab)) ||
+        memcmp(cab.magic, INSTANCIA_MAGIC, sizeof(INSTANCIA_MAGIC)) != 0) {
+        throw runtime_error("No es una instancia binaria: " + path);
+    }
+    return cab.universo;
+}
+
+// Directorio de este ejecutable (allí están los main_u<ancho>)
+static string directorio_propio(const char* argv0) {
+    string ruta;
+    char buf[4096];
+    const ssize_t n = readlink("/proc/self/exe", buf, sizeof(buf) - 1);
+    if (n > 0) ruta.assign(buf, (size_t)n);
+    else ruta = argv0;
+    const size_t barra = ruta.find_last_of('/');
+    return barra == string::npos ? "." : ruta.substr(0, barra);
+}
+
+int main(int argc, char** argv) {
+    try {
+        uint64_t universo = TFG_U_DEFECTO;
+        bool con_universo = false, con_instancia = false;
+        vector<char*> args = {nullptr};
+        for (int i = 1; i < argc; i++) {
+            const string a = argv[i];
+            if (a == "--universo" && i + 1 < argc) {
+                universo = stoull(argv[++i]);
+                con_universo = true;
+                continue;
+            }
+            if (a == "--instance" && i + 1 < argc) {
+                universo = universo_de_instancia(argv[i + 1]);
+                con_instancia = true;
+            }
+            args.push_back(argv[i]);
+        }
+        if (con_universo && con_instancia) throw runtime_error("--universo y --instance son incompatibles");
+        string universo_txt = to_string(universo);
+        if (!con_instancia) {
+            args.push_back(const_cast<char*>("--universo"));
+            args.push_back(const_cast<char*>(universo_txt.c_str()));
+        }
+        args.push_back(nullptr);
+
+        string ejecutable;
+        for (uint64_t ancho : leer_anchos()) {
+            if (universo <= ancho) {
+                ejecutable = "main_u" + to_string(ancho);
+                break;
+            }
+        }
+        if (ejecutable.empty()) {
+            if (universo > (uint64_t)TFG_U_MAX) {
+                throw runtime_error("Universo (" + to_string(universo) + ") mayor que TFG_U_MAX (" +
+                                    to_string((uint64_t)TFG_U_MAX) + ")");
+            }
+            ejecutable = "main_comprimido";
+        }
+
+        const string ruta = directorio_propio(argv[0]) + "/" + ejecutable;
+        args[0] = const_cast<char*>(ruta.c_str());
+        execv(ruta.c_str(), args.data());
+        throw runtime_error("No se pudo ejecutar " + ruta + ": " + strerror(errno));
+    } catch (const exception& e) {
+        cerr << "Error: " << e.what() << "\n";
+        return 1;
+    }
+}
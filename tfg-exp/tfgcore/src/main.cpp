@@ -6,6 +6,7 @@
 #include <vector>
 #include <string>
 #include <chrono>
+#include <memory>
 
 #include "domain.hpp"
 #include "generator.hpp"
@@ -14,7 +15,19 @@
 #include "solutions.hpp"
 #include "greedy.hpp"
 #include "genetico.hpp"
+#include "hibrido.hpp"
+#include "mapelites.hpp"
+#include "indicadores.hpp"
 #include "ground_truth.hpp"
+#include "batch.hpp"
+#include "cache.hpp"
+#include "consulta.hpp"
+#include "decision_sat.hpp"
+#include "encuentro.hpp"
+#include "instance_io.hpp"
+#include "runner.hpp"
+#include "salida.hpp"
+#include "servidor.hpp"
 
 using namespace std;
 
@@ -39,26 +52,54 @@ inline std::vector<SolMO> individuos_a_solmos(const std::vector<Individuo>& v) {
 // Impresión sencilla de los conjuntos G y F
 // ------------------------------------------------------------------
 static void print_conjuntos(const Bitset& G, const std::vector<Bitset>& F) {
-    cout << "=== CONJUNTOS ===" << endl;
-    cout << "CONJUNTO_G: ";
-    for (int i = 0; i < U_size; ++i) {
-        if (G[i]) {
-            cout << i << ",";
-        }
+    string out;
+    anadir_conjuntos_texto(out, G, F);
+    cout.write(out.data(), (streamsize)out.size());
+}
+
+// ------------------------------------------------------------------
+// Decisión exacta por SAT: resultado por k y testigo
+// ------------------------------------------------------------------
+static ResultadoDecision ejecutar_decision(const std::vector<Bitset>& F, const Bitset& U, const Bitset& G,
+                                           int k, long long max_conflictos, long long& dur_ms) {
+    ParametrosDecision pd;
+    pd.max_ops = k;
+    pd.max_conflictos = max_conflictos;
+    auto t0 = chrono::steady_clock::now();
+    auto res = decidir_exacto(F, U, G, pd);
+    dur_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+
+    cout << "Atomos: " << res.atomos << " | Variables: " << res.variables
+         << " | Clausulas: " << res.clausulas << "\n";
+    cout << "Conflictos: " << res.sat.conflictos << " | Decisiones: " << res.sat.decisiones << "\n";
+    for (size_t i = 0; i < res.por_k.size(); i++) {
+        cout << "  k <= " << i << ": " << nombre_estado(res.por_k[i]) << "\n";
     }
-    cout << "\n\n";
-
-    cout << "NUM_CONJUNTOS_F: " << F.size() << "\n";
-    for (size_t j = 0; j < F.size(); ++j) {
-        cout << "F" << j << ": ";
-        for (int i = 0; i < U_size; ++i) {
-            if (F[j][i]) {
-                cout << i << ",";
-            }
-        }
-        cout << "\n";
+    cout << "DECISION_EXACTA: " << nombre_estado(res.estado) << "\n";
+    if (res.estado == EstadoSAT::SAT) {
+        cout << "Testigo: " << res.testigo.expr_str << " (" << res.testigo.n_ops << " ops)\n";
+    }
+    cout << "Tiempo_ejecucion_ms: " << dur_ms << "\n\n";
+    return res;
+}
+
+// ------------------------------------------------------------------
+// Búsqueda bidireccional de G exacto: tabla, pares y expresión
+// ------------------------------------------------------------------
+static ResultadoEncuentro ejecutar_encuentro_mitm(const std::vector<Bitset>& F, const Bitset& U, const Bitset& G,
+                                                  int k, long long& dur_ms) {
+    auto t0 = chrono::steady_clock::now();
+    auto res = busqueda_encuentro(F, U, G, k);
+    dur_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+
+    cout << "Tabla: " << res.tabla << " conjuntos (<= " << res.profundidad_tabla << " ops)"
+         << " | Pares: " << res.pares << "\n";
+    cout << "HIT_MITM: " << (res.encontrada ? "SI" : "NO") << "\n";
+    if (res.encontrada) {
+        cout << "Expresion: " << res.expresion.expr_str << " (" << res.expresion.n_ops << " ops)\n";
     }
-    cout << "\n";
+    cout << "Tiempo_ejecucion_ms: " << dur_ms << "\n\n";
+    return res;
 }
 
 // ------------------------------------------------------------------
@@ -76,16 +117,52 @@ int main(int argc, char** argv) {
     bool ejecutar_exhaustiva= true;
     bool ejecutar_greedy= true;
     bool ejecutar_genetico= false;
+    bool ejecutar_hibrido= false;
+    HibridoParams hib_params; // greedy -> NSGA-II sembrado -> búsqueda local
+    bool ejecutar_mapelites= false;
+    MapElitesParams me_params; // MAP-Elites sobre la rejilla (n_ops, |H|)
+    double consulta_tau= -1.0; // consulta puntual: Jaccard mínimo (< 0 = desactivada)
+    int consulta_max_sets= -1; // consulta puntual: |H| máximo (-1 = sin límite)
+    bool ejecutar_sat= false; // decisión exacta (Jaccard = 1 con <= k operaciones) por SAT
+    long long sat_conflictos= -1; // conflictos por llamada al resolutor SAT (-1 = sin límite)
+    bool ejecutar_encuentro= false; // búsqueda bidireccional de G exacto (meet-in-the-middle)
+    bool precribar= false; // greedy: descartar candidatos con una cota superior del Jaccard
+    PrecribadoGreedy precribado; // parámetros del precribado (delta = 0: exacto)
     int pop_size=150;
     double mutation_prob= 0.5;      
     double crossover_prob= 0.8;     
     int tournament_size= 5;         
     int max_generations= 1e9;       
     int time_limit= 900;   
+    double memetica_frac= 0.0; // fracción del primer frente con búsqueda local (GA)
+    int memetica_pasos= 10; // pasos de escalada por individuo (GA)
+    bool simplificar= false; // simplificar y canonizar los hijos (GA)
+    int max_reintentos= 50; // hijos repetidos seguidos antes de inyectar diversidad (GA)
+    bool seleccion_hv= false; // supervivencia por contribución al hipervolumen (GA)
     bool modo_test= true; // modo test por defecto
+    int n_objetivos= 1; // número de conjuntos objetivo G (modo lote si > 1)
+    string objetivos_path; // fichero de objetivos G, uno por línea (modo lote)
+    string instancia_path; // instancia binaria a cargar (en lugar de generarla)
+    string guardar_path; // fichero donde guardar la instancia usada
+    string convertir_desde, convertir_hacia; // conversión texto -> binario
+    string generar_path; // generar instancia escalable en binario
+    GenEscalableConfig gen_cfg; // parámetros del generador escalable
+    int hilos= 0; // hilos de trabajo (0 = todos los disponibles)
+    string manifiesto_path; // manifiesto de experimentos por lotes
+    string resultados_path= "resultados.csv"; // fichero de resultados del manifiesto
+    string resultados_formato; // csv | jsonl (por defecto según la extensión)
+    string salida_formato; // text | json | csv | bin (vacío: solo salida legible)
+    string salida_path= "-"; // fichero de la salida legible por máquina ("-" = stdout)
+    bool silencioso= false; // omitir volcados legibles (conjuntos y frentes)
+    bool con_expresiones= true; // incluir el texto de las expresiones en la salida
+    bool modo_servidor= false; // atender peticiones (stdin o socket)
+    string socket_path; // socket Unix del servidor (vacío = stdin/stdout)
+    uint64_t tablas_max_bytes = 1024ull << 20; // memoria máxima de las tablas de la exhaustiva por instancia (servidor)
+    CacheSoluciones cache; // caché de soluciones en disco (dir vacío = desactivada)
     int seed_expr= (uint64_t)chrono::high_resolution_clock::now().time_since_epoch().count();      
     
-    // Conjunto universo U
+    // Conjunto universo U (--universo lo reduce; una instancia lo fija)
+    uint64_t universo_arg = 0;
     int n = U_size;
     Bitset U;
     for (int i = 0; i < n; ++i) U[i] = 1;
@@ -107,50 +184,295 @@ int main(int argc, char** argv) {
         else if (a == "--tournament_size") {tournament_size=stoi(argv[++i]);} // tamaño torneo GA
         else if (a == "--max_generations") {max_generations=stoi(argv[++i]);} // número máximo de generaciones GA
         else if (a == "--time_limit") {time_limit=stoi(argv[++i]);} // límite de tiempo GA (segundos)
+        else if (a == "--memetic") {memetica_frac=stod(argv[++i]);} // fracción del primer frente con búsqueda local
+        else if (a == "--memetic_steps") {memetica_pasos=stoi(argv[++i]);} // pasos de escalada por individuo
+        else if (a == "--simplify") simplificar= true; // simplificar y canonizar los hijos del GA
+        else if (a == "--max_retries") max_reintentos=stoi(argv[++i]); // repetidos seguidos antes de inyectar diversidad
+        else if (a == "--survival") { // supervivencia del GA: crowding | hv
+            string sup = argv[++i];
+            if (sup != "crowding" && sup != "hv") throw invalid_argument("Supervivencia desconocida: " + sup);
+            seleccion_hv = (sup == "hv");
+        }
         else if (a == "--no-test") modo_test= false; // desactivar modo test
         else if (a == "--seed_expr") seed_expr=stoi(argv[++i]); // semilla para GA
+        else if (a == "--batch") n_objetivos=stoi(argv[++i]); // número de objetivos G (modo lote)
+        else if (a == "--targets") objetivos_path=argv[++i]; // fichero de objetivos G (modo lote)
+        else if (a == "--instance") instancia_path=argv[++i]; // cargar instancia binaria
+        else if (a == "--universo") universo_arg=stoull(argv[++i]); // tamaño del universo generado (<= U_size)
+        else if (a == "--save_instance") guardar_path=argv[++i]; // guardar instancia en binario
+        else if (a == "--convert") { // convertir volcado de texto a binario
+            convertir_desde=argv[++i];
+            convertir_hacia=argv[++i];
+        }
+        else if (a == "--gen_instance") generar_path=argv[++i]; // generar instancia escalable
+        else if (a == "--gen_n") gen_cfg.n=stoull(argv[++i]); // tamaño del universo (generador escalable)
+        else if (a == "--gen_F") gen_cfg.F_n=stoi(argv[++i]); // número de conjuntos en F (generador escalable)
+        else if (a == "--gen_Gmax") gen_cfg.G_size_max=stoull(argv[++i]); // tamaño máximo de G (generador escalable)
+        else if (a == "--overlap") gen_cfg.solapamiento=stod(argv[++i]); // fracción de G dentro de la unión de F
+        else if (a == "--correlation") gen_cfg.correlacion=stod(argv[++i]); // fracción de F_i tomada de su grupo
+        else if (a == "--groups") gen_cfg.num_grupos=stoi(argv[++i]); // número de grupos de conjuntos
+        else if (a == "--threads") hilos=stoi(argv[++i]); // hilos de trabajo (0 = todos)
+        else if (a == "--manifest") manifiesto_path=argv[++i]; // ejecutar un manifiesto de experimentos
+        else if (a == "--results") resultados_path=argv[++i]; // fichero de resultados del manifiesto
+        else if (a == "--results_format") resultados_formato=argv[++i]; // csv | jsonl
+        else if (a == "--output") salida_formato=argv[++i]; // text | json | csv | bin
+        else if (a == "--output_file") salida_path=argv[++i]; // fichero de salida ("-" = stdout)
+        else if (a == "--quiet") silencioso= true; // sin volcados legibles
+        else if (a == "--no_expr") con_expresiones= false; // omitir expresiones en la salida
+        else if (a == "--server") modo_servidor= true; // modo servidor
+        else if (a == "--socket") socket_path=argv[++i]; // socket Unix del servidor
+        else if (a == "--cache") cache.dir=argv[++i]; // directorio de la caché de soluciones
+        else if (a == "--cache_max_mb") cache.max_bytes=stoull(argv[++i]) << 20; // tamaño máximo de la caché
+        else if (a == "--table_max_mb") tablas_max_bytes=stoull(argv[++i]) << 20; // memoria de las tablas de la exhaustiva por instancia (servidor)
+        else if (a == "--seed_mutants") hib_params.mutantes_por_semilla=stoi(argv[++i]); // mutaciones por semilla greedy (híbrido)
+        else if (a == "--local_rounds") hib_params.max_rondas_local=stoi(argv[++i]); // rondas de búsqueda local (híbrido)
+        else if (a == "--local_evals") hib_params.max_evaluaciones_local=stoull(argv[++i]); // evaluaciones de búsqueda local (híbrido)
+        else if (a == "--me_batch") me_params.lote=stoi(argv[++i]); // hijos por lote (MAP-Elites)
+        else if (a == "--me_init") me_params.poblacion_inicial=stoi(argv[++i]); // individuos aleatorios iniciales (MAP-Elites)
+        else if (a == "--query") consulta_tau=stod(argv[++i]); // menor expresión con Jaccard >= tau (hasta k operaciones)
+        else if (a == "--query_max_sets") consulta_max_sets=stoi(argv[++i]); // |H| máximo de la consulta
+        else if (a == "--exact") ejecutar_sat= true; // decisión exacta por SAT (modo ground truth)
+        else if (a == "--sat_conflicts") sat_conflictos=stoll(argv[++i]); // presupuesto de conflictos SAT
+        else if (a == "--mitm") ejecutar_encuentro= true; // búsqueda bidireccional de G exacto (modo ground truth)
+        else if (a == "--prescreen") precribar= true; // precribado exacto en el greedy
+        else if (a == "--prescreen_delta") { precribar= true; precribado.delta=stod(argv[++i]); } // > 0: cota muestral (frente aproximado)
         else if (a == "--algo") { // elegir algoritmo
             string algo = argv[++i];
             ejecutar_exhaustiva = (algo == "exhaustiva" || algo == "all");
             ejecutar_greedy = (algo == "greedy" || algo =="both" || algo == "all");
             ejecutar_genetico = (algo == "genetico" || algo == "both" || algo == "all");
+            ejecutar_hibrido = (algo == "hibrido");
+            ejecutar_mapelites = (algo == "mapelites");
+            // --exact y --mitm se suman a cualquier --algo (en cualquier orden)
+            if (algo == "sat") ejecutar_sat = true;
+            if (algo == "mitm") ejecutar_encuentro = true;
         }
     }
 
+    if (universo_arg > 0) {
+        if (!instancia_path.empty()) throw invalid_argument("--universo y --instance son incompatibles");
+        U = universo_hasta(universo_arg);
+        n = (int)universo_arg;
+        cache.universo = universo_arg;
+    }
+
+    const CacheSoluciones* cache_ptr = cache.dir.empty() ? nullptr : &cache;
+    // El greedy con precribado aproximado no comparte la caché del exacto
+    const CacheSoluciones* cache_greedy = (precribar && precribado.delta > 0.0) ? nullptr : cache_ptr;
+
+    // Carga una instancia binaria y ajusta U (y n) al universo de su cabecera
+    auto cargar = [&](const string& path) {
+        uint64_t universo = 0;
+        GroundTruthInstance inst = cargar_instancia(path, &universo);
+        U = universo_hasta(universo);
+        n = (int)universo;
+        cache.universo = universo;
+        return inst;
+    };
+    bool en_cache = false; // la última resolución salió de la caché
+
+    // Sin salida legible: std::cout descarta todo (la salida con --output va directa a stdout)
+    if (silencioso) cout.setstate(ios::failbit);
+
+    // Conversión de un volcado de texto al formato binario
+    if (!convertir_desde.empty()) {
+        convertir_texto_a_binario(convertir_desde, convertir_hacia);
+        cout << "Instancia convertida: " << convertir_hacia << "\n";
+        return 0;
+    }
+
+    // Generación escalable directamente a formato binario
+    if (!generar_path.empty()) {
+        gen_cfg.Fi_size_min = Fi_size_min;
+        gen_cfg.Fi_size_max = Fi_size_max;
+        gen_cfg.G_size_min = G_size_min;
+        gen_cfg.G_size_max = max<uint64_t>(gen_cfg.G_size_max, gen_cfg.G_size_min);
+        gen_cfg.seed = seed;
+        gen_cfg.hilos = hilos;
+        auto t0 = chrono::steady_clock::now();
+        generar_instancia_escalable(gen_cfg, generar_path);
+        auto t1 = chrono::steady_clock::now();
+        cout << "Instancia generada: " << generar_path << "\n";
+        cout << "Tiempo_ejecucion_ms: " << chrono::duration_cast<chrono::milliseconds>(t1 - t0).count() << "\n";
+        return 0;
+    }
+
+    // Modo servidor: la instancia "default" queda residente (cargada o generada)
+    if (modo_servidor) {
+        Servidor servidor(hilos, tablas_max_bytes);
+        std::vector<Bitset> F = instancia_path.empty()
+            ? generar_F(n, F_n_min, F_n_max, Fi_size_min, Fi_size_max, seed)
+            : cargar(instancia_path).F;
+        servidor.registrar_instancia("default", move(F), U);
+        cerr << "Servidor listo" << (socket_path.empty() ? " (stdin)" : " en " + socket_path) << "\n";
+        if (socket_path.empty()) servidor.servir_stdin();
+        else servidor.servir_socket(socket_path);
+        return 0;
+    }
+
+    // Manifiesto de experimentos: todas las ejecuciones en un único proceso
+    if (!manifiesto_path.empty()) {
+        if (resultados_formato.empty()) {
+            size_t p = resultados_path.rfind('.');
+            resultados_formato = (p != string::npos && resultados_path.substr(p) == ".jsonl") ? "jsonl" : "csv";
+        }
+        auto ejecuciones = leer_manifiesto(manifiesto_path);
+        cout << "Ejecuciones: " << ejecuciones.size() << "\n";
+        auto t0 = chrono::steady_clock::now();
+        int errores = ejecutar_manifiesto(ejecuciones, resultados_path, resultados_formato, hilos);
+        auto t1 = chrono::steady_clock::now();
+        cout << "Resultados: " << resultados_path << "\n";
+        cout << "Errores: " << errores << "\n";
+        cout << "Tiempo_ejecucion_ms: " << chrono::duration_cast<chrono::milliseconds>(t1 - t0).count() << "\n";
+        return errores == 0 ? 0 : 1;
+    }
+
+    /* Modo lote: una familia F y varios objetivos G. Con --instance el
+        primero es el G de la instancia; el resto sale de --targets o,
+        sin fichero, se genera con las semillas seed + t. */
+    if (modo_test && (n_objetivos > 1 || !objetivos_path.empty())) {
+        std::vector<Bitset> F;
+        std::vector<Bitset> Gs;
+        std::vector<string> origen; // de dónde sale cada objetivo
+        if (instancia_path.empty()) {
+            F = generar_F(n, F_n_min, F_n_max, Fi_size_min, Fi_size_max, seed);
+        } else {
+            auto inst = cargar(instancia_path);
+            F = move(inst.F);
+            Gs.push_back(inst.G);
+            origen.push_back("instancia");
+        }
+        if (!objetivos_path.empty()) {
+            auto leidos = cargar_objetivos(objetivos_path, n);
+            for (size_t i = 0; i < leidos.size(); i++) {
+                Gs.push_back(leidos[i]);
+                origen.push_back(objetivos_path + " #" + to_string(i));
+            }
+        } else {
+            for (int t = (int)Gs.size(); t < n_objetivos; t++) {
+                Gs.push_back(generar_G(n, G_size_min, seed + t));
+                origen.push_back("semilla " + to_string(seed + t));
+            }
+        }
+
+        cout << "Semilla: " << seed << "\n";
+        cout << "U_size: " << n << "\n";
+        cout << "Num_objetivos: " << Gs.size() << "\n\n";
+
+        // EXHAUSTIVA POR LOTES
+        cout << "=== EXHAUSTIVA (LOTE) ===\n";
+        auto t0 = chrono::high_resolution_clock::now();
+        auto frentes = batch_exhaustive_search(F, U, Gs, k);
+        auto t1 = chrono::high_resolution_clock::now();
+        auto dur_ms = chrono::duration_cast<chrono::milliseconds>(t1 - t0).count();
+
+        cout << "Tiempo_ejecucion_ms: " << dur_ms << "\n\n";
+        if (!silencioso) {
+            for (size_t t = 0; t < frentes.size(); t++) {
+                cout << "=== OBJETIVO " << t << " (" << origen[t] << ") ===\n";
+                print_pareto_front(frentes[t]);
+            }
+        }
+        if (!salida_formato.empty()) {
+            EscritorResultados escritor(leer_formato_salida(salida_formato), seed, n, con_expresiones);
+            for (size_t t = 0; t < frentes.size(); t++) {
+                escritor.frente("Objetivo_" + to_string(t), dur_ms, frentes[t]);
+            }
+            escritor.volcar(salida_path);
+        }
+        return 0;
+    }
+
     // Modo de prueba: generar conjuntos y ejecutar algoritmos seleccionados
     if (modo_test) {
-        // Generar conjuntos
-        Bitset G = generar_G(n, G_size_min, seed);
-        std::vector<Bitset> F = generar_F(n, F_n_min, F_n_max, Fi_size_min, Fi_size_max, seed);
+        // Generar conjuntos (o cargarlos de una instancia binaria)
+        Bitset G;
+        std::vector<Bitset> F;
+        if (instancia_path.empty()) {
+            G = generar_G(n, G_size_min, seed);
+            F = generar_F(n, F_n_min, F_n_max, Fi_size_min, Fi_size_max, seed);
+        } else {
+            auto inst = cargar(instancia_path);
+            G = inst.G;
+            F = move(inst.F);
+            seed = (int)inst.seed;
+        }
+        if (!guardar_path.empty()) guardar_instancia(guardar_path, F, G, nullptr, seed, n);
 
         cout << "Semilla: " << seed << "\n";
-        cout << "U_size: " << U_size << "\n";
-        print_conjuntos(G, F); 
+        cout << "U_size: " << n << "\n";
+        if (!silencioso) print_conjuntos(G, F); 
+
+        // Salida legible por máquina (se escribe de una vez al final)
+        unique_ptr<EscritorResultados> escritor;
+        if (!salida_formato.empty()) {
+            escritor.reset(new EscritorResultados(leer_formato_salida(salida_formato), seed, n, con_expresiones));
+            escritor->instancia(G, F);
+        }
+
+        // Consulta puntual: solo la expresión más corta que cumple la restricción
+        if (consulta_tau >= 0) {
+            cout << "=== CONSULTA ===\n";
+            ParametrosConsulta pc;
+            pc.tau = consulta_tau;
+            pc.max_sizeH = consulta_max_sets;
+            pc.max_ops = k;
+            auto t0 = chrono::steady_clock::now();
+            auto res = consulta_min_ops(F, U, G, pc);
+            auto dur_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+
+            cout << "Tau: " << pc.tau << " | Max_sizeH: " << pc.max_sizeH << " | k: " << pc.max_ops << "\n";
+            cout << "Cota_jaccard: " << res.cota << "\n";
+            cout << "Niveles: " << res.niveles << " | Expresiones: " << res.expresiones << "\n";
+            cout << "Tiempo_ejecucion_ms: " << dur_ms << "\n\n";
+            vector<SolMO> soluciones;
+            if (res.encontrada) soluciones.push_back(res.solucion);
+            else if (res.cota < pc.tau) cout << "Sin solución: la cota de átomos no alcanza tau\n";
+            else cout << "Sin solución con k <= " << pc.max_ops << "\n";
+            if (!silencioso && res.encontrada) print_pareto_front(soluciones);
+            if (escritor) {
+                escritor->frente("Consulta", dur_ms, soluciones);
+                escritor->volcar(salida_path);
+            }
+            return res.encontrada ? 0 : 1;
+        }
 
         vector<ResultadoAlgoritmo<SolMO>> resultados;
         // Ejecutar algoritmos seleccionados
         if (ejecutar_exhaustiva) {
             // EXHAUSTIVA
             cout << "=== EXHAUSTIVA ===\n";
-            auto t0 = chrono::high_resolution_clock::now();
-            auto soluciones = exhaustive_search(F, U, G, k);
-            auto t1 = chrono::high_resolution_clock::now();
-            auto dur_ms = chrono::duration_cast<chrono::milliseconds>(t1 - t0).count();
+            long long dur_ms = 0;
+            auto soluciones = resolver_con_cache<SolMO>(cache_ptr, clave_cache(F, U, G, "exhaustiva", k),
+                dur_ms, en_cache, [&] { return exhaustive_search(F, U, G, k); });
+            if (en_cache) cerr << "Cache: exhaustiva\n";
 
+            cout << "Hipervolumen: " << hipervolumen(soluciones, k, (int)F.size()) << "\n";
             cout <<"Tiempo_ejecucion_ms: " << dur_ms << "\n\n";
-            print_pareto_front(soluciones);
+            if (!silencioso) print_pareto_front(soluciones);
+            if (escritor) escritor->frente("Exhaustiva", dur_ms, soluciones);
             resultados.push_back({"Exhaustiva", soluciones, dur_ms});
         }
         if (ejecutar_greedy) {
             // GREEDY
             cout << "=== GREEDY ===\n";
-            auto t0 = chrono::high_resolution_clock::now();
-            auto soluciones = greedy_multiobjective_search(F, U, G, k);
-            auto t1 = chrono::high_resolution_clock::now();
-            auto dur_ms = chrono::duration_cast<chrono::milliseconds>(t1 - t0).count();
+            long long dur_ms = 0;
+            EstadisticasPrecribado st_pre;
+            auto soluciones = resolver_con_cache<SolMO>(cache_greedy, clave_cache(F, U, G, "greedy", k),
+                dur_ms, en_cache, [&] {
+                    return greedy_multiobjective_search(F, U, G, k, precribar ? &precribado : nullptr, &st_pre);
+                });
+            if (en_cache) cerr << "Cache: greedy\n";
+            else if (precribar) {
+                cout << "Precribado: " << st_pre.descartados << " descartados / " << st_pre.candidatos << " candidatos ("
+                     << (precribado.delta > 0.0 ? "aproximado, delta " + to_string(precribado.delta) : string("exacto"))
+                     << ")\n";
+            }
 
+            cout << "Hipervolumen: " << hipervolumen(soluciones, k, (int)F.size()) << "\n";
             cout <<"Tiempo_ejecucion_ms: " << dur_ms << "\n\n";
-            print_pareto_front(soluciones);
+            if (!silencioso) print_pareto_front(soluciones);
+            if (escritor) escritor->frente("Greedy", dur_ms, soluciones);
             resultados.push_back({"Greedy", soluciones, dur_ms});
         }
         if (ejecutar_genetico) {
@@ -164,42 +486,160 @@ int main(int argc, char** argv) {
             ga_params.mutation_prob     = mutation_prob;
             ga_params.tournament_size   = tournament_size;
             ga_params.seed              = seed_expr;
+            ga_params.memetica_frac     = memetica_frac;
+            ga_params.memetica_pasos    = memetica_pasos;
+            ga_params.simplificar       = simplificar;
+            ga_params.max_reintentos    = max_reintentos;
+            ga_params.seleccion_hv      = seleccion_hv;
 
             cout << "Semilla_GA: " << ga_params.seed << "\n";
-            cout << "Población: " << ga_params.population_size << endl;
-            cout << "Limite_tiempo (s): " << ga_params.time_limit_sec << endl;
-            cout << "Prob. mutación: " << ga_params.mutation_prob << endl;
-            cout << "Prob. cruce: " << ga_params.crossover_prob << endl;
+            cout << "Población: " << ga_params.population_size << "\n";
+            cout << "Limite_tiempo (s): " << ga_params.time_limit_sec << "\n";
+            cout << "Prob. mutación: " << ga_params.mutation_prob << "\n";
+            cout << "Prob. cruce: " << ga_params.crossover_prob << "\n";
             cout << "Tamaño torneo: " << ga_params.tournament_size << "\n";
             cout << "Generaciones máx.: " << ga_params.max_generations << "\n";
 
-            auto t0 = chrono::high_resolution_clock::now();
-            auto soluciones = nsga2(F, U, G, k, ga_params);
-            auto t1 = chrono::high_resolution_clock::now();
-            auto dur_ms = chrono::duration_cast<chrono::milliseconds>(t1 - t0).count();
+            long long dur_ms = 0;
+            EstadisticasGA st_ga;
+            auto soluciones = resolver_con_cache<Individuo>(cache_ptr, clave_cache(F, U, G, "genetico", k, &ga_params),
+                dur_ms, en_cache, [&] { return nsga2(F, U, G, k, ga_params, &st_ga); });
+            if (en_cache) cerr << "Cache: genetico\n";
+            else {
+                cout << "Generaciones: " << st_ga.generaciones << "\n";
+                cout << "Duplicados_rechazados: " << st_ga.duplicados << "\n";
+                cout << "Inmigrantes: " << st_ga.inmigrantes << " | Mutantes: " << st_ga.mutantes
+                     << " | Huecos_vacios: " << st_ga.huecos_vacios << "\n";
+            }
 
+            cout << "Hipervolumen: " << hipervolumen(soluciones, k, (int)F.size()) << "\n";
             cout <<"Tiempo_ejecucion_ms: " << dur_ms << "\n\n";
-            print_pareto_front(soluciones);
+            if (!silencioso) print_pareto_front(soluciones);
+            if (escritor) escritor->frente("Genetico_NSGA-II", dur_ms, soluciones);
             resultados.push_back({"Genetico_NSGA-II", individuos_a_solmos(soluciones), dur_ms});
         }
+        if (ejecutar_hibrido) {
+            // HIBRIDO (GREEDY -> NSGA-II -> BUSQUEDA LOCAL)
+            cout << "=== HIBRIDO ===\n";
+            hib_params.ga.population_size   = pop_size;
+            hib_params.ga.max_generations   = max_generations;
+            hib_params.ga.time_limit_sec    = time_limit;
+            hib_params.ga.crossover_prob    = crossover_prob;
+            hib_params.ga.mutation_prob     = mutation_prob;
+            hib_params.ga.tournament_size   = tournament_size;
+            hib_params.ga.seed              = seed_expr;
+            hib_params.ga.memetica_frac     = memetica_frac;
+            hib_params.ga.memetica_pasos    = memetica_pasos;
+            hib_params.ga.simplificar       = simplificar;
+            hib_params.ga.max_reintentos    = max_reintentos;
+            hib_params.ga.seleccion_hv      = seleccion_hv;
+
+            EstadisticasHibrido st;
+            auto t0 = chrono::steady_clock::now();
+            auto soluciones = hibrido(F, U, G, k, hib_params, &st);
+            auto dur_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+
+            cout << "Semilla_GA: " << hib_params.ga.seed << "\n";
+            cout << "Semillas: " << st.semillas << "\n";
+            cout << "Tiempo_greedy_ms: " << st.ms_greedy << "\n";
+            cout << "Tiempo_genetico_ms: " << st.ms_genetico << "\n";
+            cout << "Tiempo_local_ms: " << st.ms_local << "\n";
+            cout << "Evaluaciones_local: " << st.evaluaciones_local << "\n";
+            cout << "Mejoras_local: " << st.mejoras_local << "\n";
+            cout << "Hipervolumen: " << hipervolumen(soluciones, k, (int)F.size()) << "\n";
+            cout <<"Tiempo_ejecucion_ms: " << dur_ms << "\n\n";
+            if (!silencioso) print_pareto_front(soluciones);
+            if (escritor) escritor->frente("Hibrido", dur_ms, soluciones);
+            resultados.push_back({"Hibrido", individuos_a_solmos(soluciones), dur_ms});
+        }
+        if (ejecutar_mapelites) {
+            // MAP-ELITES (una élite por celda (n_ops, |H|))
+            cout << "=== MAP-ELITES ===\n";
+            me_params.max_lotes         = max_generations;
+            me_params.time_limit_sec    = time_limit;
+            me_params.crossover_prob    = crossover_prob;
+            me_params.mutation_prob     = mutation_prob;
+            me_params.simplificar       = simplificar;
+            me_params.hilos             = hilos;
+            me_params.seed              = seed_expr;
+
+            auto t0 = chrono::steady_clock::now();
+            auto res = map_elites(F, U, G, k, me_params);
+            auto dur_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+            auto soluciones = res.archivo.elites();
+
+            cout << "Semilla_GA: " << me_params.seed << "\n";
+            cout << "Lotes: " << res.lotes << " | Hijos por lote: " << me_params.lote << "\n";
+            cout << "Evaluaciones: " << res.evaluaciones << "\n";
+            cout << "Celdas: " << res.archivo.num_ocupadas() << " / " << res.archivo.alcanzables << "\n";
+            // Evolución de la cobertura (solo cuando cambia)
+            int celdas_previas = -1;
+            for (const auto& p : res.cobertura) {
+                if (p.celdas == celdas_previas && &p != &res.cobertura.back()) continue;
+                celdas_previas = p.celdas;
+                cout << "  Cobertura @" << p.ms << " ms, " << p.evaluaciones << " evals: "
+                     << p.celdas << " celdas (" << p.cobertura << "), HV " << p.hipervolumen << "\n";
+            }
+            cout << "Hipervolumen: " << hipervolumen(soluciones, k, (int)F.size()) << "\n";
+            cout <<"Tiempo_ejecucion_ms: " << dur_ms << "\n\n";
+            if (!silencioso) print_pareto_front(soluciones);
+            if (escritor) escritor->frente("MAP-Elites", dur_ms, soluciones);
+            resultados.push_back({"MAP-Elites", individuos_a_solmos(soluciones), dur_ms});
+        }
+        if (ejecutar_sat) {
+            // DECISION EXACTA (SAT)
+            cout << "=== EXACTA (SAT) ===\n";
+            long long dur_ms = 0;
+            auto res = ejecutar_decision(F, U, G, k, sat_conflictos, dur_ms);
+            vector<SolMO> soluciones;
+            if (res.estado == EstadoSAT::SAT) {
+                soluciones.emplace_back(res.testigo, res.testigo.n_ops, (int)res.testigo.used_sets.size(), 1.0);
+            }
+            if (escritor) escritor->frente("Exacta_SAT", dur_ms, soluciones);
+            resultados.push_back({"Exacta_SAT", soluciones, dur_ms});
+        }
+        if (ejecutar_encuentro) {
+            // MEET-IN-THE-MIDDLE (G EXACTO)
+            cout << "=== ENCUENTRO (MITM) ===\n";
+            long long dur_ms = 0;
+            auto res = ejecutar_encuentro_mitm(F, U, G, k, dur_ms);
+            vector<SolMO> soluciones;
+            if (res.encontrada) {
+                soluciones.emplace_back(res.expresion, res.expresion.n_ops, (int)res.expresion.used_sets.size(), 1.0);
+            }
+            if (escritor) escritor->frente("Encuentro_MITM", dur_ms, soluciones);
+            resultados.push_back({"Encuentro_MITM", soluciones, dur_ms});
+        }
+        if (escritor) escritor->volcar(salida_path);
     }
     // Modo no test: generar instancia de ground truth y ejecutar NSGA-II y Greedy
     if (!modo_test){
-        // Generar instancia de ground truth
-        auto gt = make_groundtruth(U, U_size, F_n_min, F_n_max, Fi_size_min, Fi_size_max, k, seed);
+        // Generar instancia de ground truth (o cargarla de una instancia binaria)
+        auto gt = instancia_path.empty()
+            ? make_groundtruth(U, n, F_n_min, F_n_max, Fi_size_min, Fi_size_max, k, seed)
+            : cargar(instancia_path);
+        if (!guardar_path.empty()) guardar_instancia(guardar_path, gt.F, gt.G, &gt.gold_expr, gt.seed, n);
 
         cout << "=== INSTANCIA ===\n";
         cout << "Semilla: " << gt.seed << "\n";
-        cout << "U_size: " << U_size << "\n";
+        cout << "U_size: " << n << "\n";
         cout << "k: " << k << "\n";
         cout << "Expresion de referencia: " << gt.gold_expr.expr_str << "\n";
         cout << "Jaccard_objetivo: " << M(gt.gold_expr, gt.G, Metric::Jaccard) << "\n";
         cout << "\n";
         
         // Datos para reproducibilidad (para el script)
-        cout << "@@@REPRO_DATA_START@@@\n";
-        print_conjuntos(gt.G, gt.F); 
-        cout << "@@@REPRO_DATA_END@@@\n";
+        if (!silencioso) {
+            cout << "@@@REPRO_DATA_START@@@\n";
+            print_conjuntos(gt.G, gt.F); 
+            cout << "@@@REPRO_DATA_END@@@\n";
+        }
+
+        unique_ptr<EscritorResultados> escritor;
+        if (!salida_formato.empty()) {
+            escritor.reset(new EscritorResultados(leer_formato_salida(salida_formato), gt.seed, n, con_expresiones));
+            escritor->instancia(gt.G, gt.F);
+        }
 
         // NSGA-II
         GAParams ga_params;
@@ -210,11 +650,16 @@ int main(int argc, char** argv) {
         ga_params.mutation_prob     = mutation_prob;
         ga_params.tournament_size   = tournament_size;
         ga_params.seed              = seed_expr;
+        ga_params.memetica_frac     = memetica_frac;
+        ga_params.memetica_pasos    = memetica_pasos;
+        ga_params.simplificar       = simplificar;
+        ga_params.max_reintentos    = max_reintentos;
+        ga_params.seleccion_hv      = seleccion_hv;
 
-        auto t0 = chrono::steady_clock::now();
-        auto pareto = nsga2(gt.F, U, gt.G, k, ga_params);
-        auto t1 = chrono::steady_clock::now();
-        auto dur_ms = chrono::duration_cast<chrono::milliseconds>(t1 - t0).count();
+        long long dur_ms = 0;
+        auto pareto = resolver_con_cache<Individuo>(cache_ptr, clave_cache(gt.F, U, gt.G, "genetico", k, &ga_params),
+            dur_ms, en_cache, [&] { return nsga2(gt.F, U, gt.G, k, ga_params); });
+        if (en_cache) cerr << "Cache: genetico\n";
 
         cout << "=== GENÉTICO (NSGA-II) ===\n";
         cout << "Tiempo (ms): " << dur_ms << "\n";
@@ -224,22 +669,54 @@ int main(int argc, char** argv) {
                 << " | p_cruce: " << ga_params.crossover_prob
                 << " | torneo: " << ga_params.tournament_size << "\n"; 
 
-        print_pareto_front(pareto);
+        if (!silencioso) print_pareto_front(pareto);
+        if (escritor) escritor->frente("Genetico_NSGA-II", dur_ms, pareto);
         bool hit = any_of(pareto.begin(), pareto.end(), [](const auto& s) {
             return s.jaccard == 1.0; });
             
         // Alcanzó el objetivo (Jaccard = 1.0)?
         cout << "HIT_OBJETIVO: " << (hit ? "SI" : "NO") << "\n\n\n";
         
+        // DECISION EXACTA (SAT)
+        if (ejecutar_sat) {
+            cout << "=== EXACTA (SAT) ===\n";
+            long long dur_sat = 0;
+            auto res = ejecutar_decision(gt.F, U, gt.G, k, sat_conflictos, dur_sat);
+            if (escritor) {
+                vector<SolMO> testigo;
+                if (res.estado == EstadoSAT::SAT) {
+                    testigo.emplace_back(res.testigo, res.testigo.n_ops, (int)res.testigo.used_sets.size(), 1.0);
+                }
+                escritor->frente("Exacta_SAT", dur_sat, testigo);
+            }
+        }
+
+        // MEET-IN-THE-MIDDLE (G EXACTO)
+        if (ejecutar_encuentro) {
+            cout << "=== ENCUENTRO (MITM) ===\n";
+            long long dur_mitm = 0;
+            auto res = ejecutar_encuentro_mitm(gt.F, U, gt.G, k, dur_mitm);
+            if (escritor) {
+                vector<SolMO> hit;
+                if (res.encontrada) {
+                    hit.emplace_back(res.expresion, res.expresion.n_ops, (int)res.expresion.used_sets.size(), 1.0);
+                }
+                escritor->frente("Encuentro_MITM", dur_mitm, hit);
+            }
+        }
+
         // GREEDY
         cout << "=== GREEDY ===\n";
-        auto t00 = chrono::high_resolution_clock::now();
-        auto soluciones = greedy_multiobjective_search(gt.F, U, gt.G, k);
-        auto t11 = chrono::high_resolution_clock::now();
-        dur_ms = chrono::duration_cast<chrono::milliseconds>(t11 - t00).count();
+        auto soluciones = resolver_con_cache<SolMO>(cache_greedy, clave_cache(gt.F, U, gt.G, "greedy", k),
+            dur_ms, en_cache, [&] { return greedy_multiobjective_search(gt.F, U, gt.G, k, precribar ? &precribado : nullptr); });
+        if (en_cache) cerr << "Cache: greedy\n";
 
         cout <<"Tiempo_ejecucion_ms: " << dur_ms << "\n";
-        print_pareto_front(soluciones);
+        if (!silencioso) print_pareto_front(soluciones);
+        if (escritor) {
+            escritor->frente("Greedy", dur_ms, soluciones);
+            escritor->volcar(salida_path);
+        }
     }
     return 0;
 
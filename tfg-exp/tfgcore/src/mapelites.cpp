@@ -0,0 +1,170 @@
+//----------------------------------------------------------------------
+// mapelites.cpp
+//----------------------------------------------------------------------
+// MAP-Elites sobre la rejilla (n_ops, |H|).
+//----------------------------------------------------------------------
+
+#include "mapelites.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+
+#include "archivo_concurrente.hpp"
+#include "genetico.hpp"
+#include "indicadores.hpp"
+#include "pool.hpp"
+#include "simplificacion.hpp"
+
+using namespace std;
+
+// Hijos por bloque de trabajo (cada bloque tiene su propia semilla)
+static const int HIJOS_POR_BLOQUE = 32;
+
+//------------------------------------------------------------------
+// Archivo
+//------------------------------------------------------------------
+bool ArchivoElites::insertar(const Individuo& ind) {
+    if (ind.n_ops < 0 || ind.n_ops > max_ops || ind.sizeH < 0 || ind.sizeH > max_sizeH) return false;
+    const int c = celda(ind.n_ops, ind.sizeH);
+    // Empate: la expresión más corta (y después la menor) para ser deterministas
+    if (ocupada[c] && !preferida_en_celda(ind, elite[c])) return false;
+    elite[c] = ind;
+    elite[c].rank = 0;
+    elite[c].crowd = 0.0;
+    ocupada[c] = 1;
+    return true;
+}
+
+vector<Individuo> ArchivoElites::elites() const {
+    vector<Individuo> r;
+    for (size_t c = 0; c < elite.size(); c++) {
+        if (ocupada[c]) r.push_back(elite[c]);
+    }
+    return r;
+}
+
+int ArchivoElites::num_ocupadas() const {
+    return (int)count(ocupada.begin(), ocupada.end(), 1);
+}
+
+//------------------------------------------------------------------
+// Bucle principal
+//------------------------------------------------------------------
+ResultadoMapElites map_elites(const vector<Bitset>& F, const Bitset& U, const Bitset& G,
+                              int k, const MapElitesParams& params) {
+    const uint64_t seed = params.seed
+        ? params.seed
+        : (uint64_t)chrono::high_resolution_clock::now().time_since_epoch().count();
+    const auto inicio = chrono::steady_clock::now();
+    const auto limite = chrono::seconds(params.time_limit_sec);
+
+    ResultadoMapElites res;
+    ArchivoElites& A = res.archivo;
+    A.max_ops = max(0, k);
+    A.max_sizeH = A.max_ops + 1;
+    A.elite.assign((size_t)(A.max_ops + 1) * (A.max_sizeH + 1), Individuo());
+    A.ocupada.assign(A.elite.size(), 0);
+    for (int o = 0; o <= A.max_ops; o++) {
+        A.alcanzables += min(o + 1, (int)F.size() + 1) + 1;
+    }
+    const ReferenciaHV ref = referencia_hv(k, (int)F.size());
+
+    auto anotar = [&]() {
+        PuntoCobertura p;
+        p.ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - inicio).count();
+        p.evaluaciones = res.evaluaciones;
+        p.celdas = A.num_ocupadas();
+        p.cobertura = A.alcanzables ? (double)p.celdas / A.alcanzables : 0.0;
+        p.hipervolumen = hipervolumen(A.elites(), ref);
+        res.cobertura.push_back(p);
+    };
+
+    // Los hijos se insertan desde los hilos en un archivo compartido; A es
+    // la copia de la que se leen los padres, que se actualiza entre lotes
+    ArchivoConcurrente compartido(A.max_ops, A.max_sizeH, false);
+    auto sincronizar = [&]() {
+        Individuo ind;
+        for (int c = 0; c < compartido.num_celdas(); c++) {
+            if (compartido.leer(c, ind)) {
+                A.elite[c] = move(ind);
+                A.ocupada[c] = 1;
+            }
+        }
+        compartido.recoger();
+    };
+
+    // Archivo inicial: bloques base y expresiones aleatorias
+    const vector<SolMO> bloques_base = construir_bloques_base(F, U, G);
+    for (const auto& b : bloques_base) compartido.insertar(Individuo(b));
+    {
+        mt19937 rng(seed);
+        size_t duplicados = 0;
+        auto inicial = inicializar_poblacion(F, U, G, k, params.poblacion_inicial, rng, 1000, &duplicados);
+        for (auto& ind : inicial) {
+            if (params.simplificar && simplificar_expresion(ind.expr, F, U)) {
+                ind.n_ops = ind.expr.n_ops;
+                ind.sizeH = (int)ind.expr.used_sets.size();
+            }
+            compartido.insertar(ind);
+        }
+        res.evaluaciones = bloques_base.size() + inicial.size();
+    }
+    sincronizar();
+    anotar();
+
+    // Lotes en paralelo: los hijos leen los padres de A y se insertan en el compartido.
+    // Con un hilo no hay pool: los bloques se ejecutan (y evalúan) en el hilo llamante
+    unique_ptr<PoolTrabajo> pool;
+    if (params.hilos != 1) pool.reset(new PoolTrabajo(params.hilos));
+    const int lote = max(1, params.lote);
+    const int num_bloques = (lote + HIJOS_POR_BLOQUE - 1) / HIJOS_POR_BLOQUE;
+    vector<int> padres;
+
+    while (res.lotes < params.max_lotes && chrono::steady_clock::now() - inicio < limite) {
+        padres.clear();
+        for (int c = 0; c < (int)A.elite.size(); c++) {
+            if (A.ocupada[c]) padres.push_back(c);
+        }
+
+        for (int b = 0; b < num_bloques; b++) {
+            auto bloque = [&, b] {
+                seed_seq ss{(uint32_t)seed, (uint32_t)(seed >> 32), (uint32_t)res.lotes, (uint32_t)b};
+                mt19937 rng(ss);
+                uniform_int_distribution<int> elegir(0, (int)padres.size() - 1);
+                uniform_real_distribution<double> u01(0.0, 1.0);
+                const int fin = min(lote, (b + 1) * HIJOS_POR_BLOQUE);
+                for (int i = b * HIJOS_POR_BLOQUE; i < fin; i++) {
+                    const Individuo& p1 = A.elite[padres[elegir(rng)]];
+                    Individuo hijo;
+                    bool cruzado = false;
+                    if (u01(rng) < params.crossover_prob) {
+                        const Individuo& p2 = A.elite[padres[elegir(rng)]];
+                        hijo = crossover(p1, p2, F, U, G, k, rng);
+                        cruzado = true;
+                    } else {
+                        hijo = p1;
+                    }
+                    if (!cruzado || u01(rng) < params.mutation_prob) {
+                        mutar(hijo, F, U, G, k, rng, bloques_base);
+                    }
+                    if (params.simplificar && simplificar_expresion(hijo.expr, F, U)) {
+                        hijo.n_ops = hijo.expr.n_ops;
+                        hijo.sizeH = (int)hijo.expr.used_sets.size();
+                    }
+                    compartido.insertar(hijo);
+                }
+            };
+            if (pool) pool->enviar(bloque);
+            else bloque();
+        }
+        if (pool) pool->esperar();
+
+        sincronizar();
+        res.evaluaciones += lote;
+        res.lotes++;
+        anotar();
+    }
+    return res;
+}
@@ -0,0 +1,187 @@
+//----------------------------------------------------------------------
+// memetica.cpp
+//----------------------------------------------------------------------
+// Búsqueda local (escalada) sobre el árbol de un individuo.
+//----------------------------------------------------------------------
+
+#include "memetica.hpp"
+
+#include <map>
+#include <stdexcept>
+
+#include "arbol.hpp"
+#include "metrics.hpp"
+
+using namespace std;
+
+//------------------------------------------------------------------
+// Cuentas de un nodo: |X ∩ G| y |X \ G| (|H ∪ G| = |H \ G| + |G|)
+//------------------------------------------------------------------
+struct Cuentas {
+    int inter = 0;
+    int fuera = 0;
+};
+
+static Cuentas contar(const Bitset& X, const Bitset& G) {
+    return Cuentas{(int)set_intersect(X, G).count(), (int)set_difference(X, G).count()};
+}
+
+// Corrige las cuentas con los elementos que cambian de 'antes' a 'despues'
+static void corregir(Cuentas& c, const Bitset& antes, const Bitset& despues, const Bitset& G) {
+    const Bitset cambio = antes ^ despues;
+    const Bitset entran = set_intersect(cambio, despues);
+    const Bitset salen = set_intersect(cambio, antes);
+    c.inter += (int)set_intersect(entran, G).count() - (int)set_intersect(salen, G).count();
+    c.fuera += (int)set_difference(entran, G).count() - (int)set_difference(salen, G).count();
+}
+
+static double jaccard_de(const Cuentas& c, int card_G) {
+    const int uni = c.fuera + card_G;
+    return uni == 0 ? 1.0 : (double)c.inter / uni;
+}
+
+//------------------------------------------------------------------
+/* Cuentas de la raíz si el nodo 'v' pasara a valer 'valor'. Se sube
+    por el camino hasta que el valor deja de cambiar (entonces la raíz
+    no cambia) y en la raíz solo se cuentan los elementos que cambian. */
+//------------------------------------------------------------------
+static Cuentas cuentas_con_cambio(const ArbolExpr& t, const vector<Cuentas>& cuentas, int v,
+                                  Bitset valor, const Bitset& G) {
+    for (int hijo = v, p = t.nodos[v].padre;; hijo = p, p = t.nodos[p].padre) {
+        if (valor == t.nodos[hijo].conjunto) return cuentas[t.raiz];
+        if (p < 0) break;
+        const NodoExpr& n = t.nodos[p];
+        valor = (n.izq == hijo)
+            ? apply_op(n.op, valor, t.nodos[n.der].conjunto)
+            : apply_op(n.op, t.nodos[n.izq].conjunto, valor);
+    }
+    Cuentas c = cuentas[t.raiz];
+    corregir(c, t.nodos[t.raiz].conjunto, valor, G);
+    return c;
+}
+
+// Aplica el cambio: valores y cuentas del camino de 'v' a la raíz
+static void aplicar_cambio(ArbolExpr& t, vector<Cuentas>& cuentas, int v, Bitset valor, const Bitset& G) {
+    for (int hijo = v, p = v; p >= 0; hijo = p, p = t.nodos[p].padre) {
+        NodoExpr& n = t.nodos[p];
+        if (p != v) {
+            valor = (n.izq == hijo)
+                ? apply_op(n.op, valor, t.nodos[n.der].conjunto)
+                : apply_op(n.op, t.nodos[n.izq].conjunto, valor);
+        }
+        if (valor == n.conjunto) return;
+        corregir(cuentas[p], n.conjunto, valor, G);
+        n.conjunto = valor;
+    }
+}
+
+//------------------------------------------------------------------
+// Escalada
+//------------------------------------------------------------------
+bool mejora_local_memetica(Individuo& ind, const vector<Bitset>& F, const Bitset& U,
+                           const Bitset& G, int max_pasos, size_t* vecinos_evaluados) {
+    ArbolExpr t;
+    try {
+        t = parsear_expresion(ind.expr.expr_str, F, U);
+    } catch (const invalid_argument&) {
+        return false;
+    }
+
+    const int card_G = (int)G.count();
+    vector<Cuentas> cuentas(t.nodos.size());
+    for (size_t v = 0; v < t.nodos.size(); v++) cuentas[v] = contar(t.nodos[v].conjunto, G);
+
+    // Apariciones de cada bloque (para |H| tras cambiar una hoja). U
+    // cuenta en |H| solo si la expresión de entrada lo cuenta
+    const bool cuenta_U = ind.expr.used_sets.count(HOJA_U) > 0;
+    auto cuenta = [&](int hoja) { return hoja != HOJA_VACIA && (hoja != HOJA_U || cuenta_U); };
+    map<int, int> apariciones;
+    vector<int> hojas, internos;
+    for (int v = 0; v < (int)t.nodos.size(); v++) {
+        const NodoExpr& n = t.nodos[v];
+        if (n.op >= 0) internos.push_back(v);
+        else {
+            hojas.push_back(v);
+            if (n.hoja != HOJA_VACIA) apariciones[n.hoja]++;
+        }
+    }
+    auto tam_H = [&] {
+        return (int)apariciones.size() - (!cuenta_U && apariciones.count(HOJA_U) ? 1 : 0);
+    };
+
+    double j_act = ind.jaccard;
+    int h_act = tam_H();
+    size_t evaluados = 0;
+    bool cambiado = false;
+
+    // Jaccard del vecino con las cuentas de la raíz corregidas por el camino
+    auto puntuar = [&](int v, const Bitset& valor) {
+        evaluados++;
+        return jaccard_de(cuentas_con_cambio(t, cuentas, v, valor, G), card_G);
+    };
+    auto mejora = [&](double j, int h) {
+        return (j >= j_act && h <= h_act) && (j > j_act || h < h_act);
+    };
+
+    for (int paso = 0; paso < max_pasos; paso++) {
+        bool aplicado = false;
+
+        // Cambiar una hoja por otro bloque base
+        for (size_t a = 0; a < hojas.size() && !aplicado; a++) {
+            const int v = hojas[a];
+            const int actual = t.nodos[v].hoja;
+            for (int b = HOJA_U; b < (int)F.size(); b++) {
+                if (b == actual) continue;
+                const Bitset& valor = (b == HOJA_U) ? U : F[b];
+                double j = puntuar(v, valor);
+                int h = tam_H()
+                      - (cuenta(actual) && apariciones[actual] == 1 ? 1 : 0)
+                      + (cuenta(b) && !apariciones.count(b) ? 1 : 0);
+                if (!mejora(j, h)) continue;
+
+                // Aplicar
+                if (actual != HOJA_VACIA && --apariciones[actual] == 0) apariciones.erase(actual);
+                apariciones[b]++;
+                t.nodos[v].hoja = b;
+                aplicar_cambio(t, cuentas, v, valor, G);
+                j_act = j;
+                h_act = h;
+                aplicado = true;
+                break;
+            }
+        }
+
+        // Cambiar la operación de un nodo interno (|H| no cambia)
+        for (size_t a = 0; a < internos.size() && !aplicado; a++) {
+            const int v = internos[a];
+            const NodoExpr& n = t.nodos[v];
+            for (int op = 0; op < 3; op++) {
+                if (op == n.op) continue;
+                const Bitset valor = apply_op(op, t.nodos[n.izq].conjunto, t.nodos[n.der].conjunto);
+                double j = puntuar(v, valor);
+                if (!mejora(j, tam_H())) continue;
+
+                t.nodos[v].op = op;
+                aplicar_cambio(t, cuentas, v, valor, G);
+                j_act = j;
+                h_act = tam_H();
+                aplicado = true;
+                break;
+            }
+        }
+
+        if (!aplicado) break;
+        cambiado = true;
+    }
+
+    contar_evaluaciones(evaluados);
+    if (vecinos_evaluados) *vecinos_evaluados += evaluados;
+    if (!cambiado) return false;
+
+    ind.expr = arbol_a_expresion(t);
+    if (!cuenta_U) ind.expr.used_sets.erase(HOJA_U);
+    ind.n_ops = ind.expr.n_ops;
+    ind.sizeH = (int)M(ind.expr, G, Metric::SizeH);
+    ind.jaccard = j_act;
+    return true;
+}
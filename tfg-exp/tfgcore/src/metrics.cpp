@@ -8,6 +8,13 @@
 
 using namespace std;
 
+// Evaluaciones de Jaccard realizadas en este hilo
+static thread_local uint64_t g_evaluaciones = 0;
+
+uint64_t evaluaciones_realizadas() { return g_evaluaciones; }
+void reiniciar_evaluaciones() { g_evaluaciones = 0; }
+void contar_evaluaciones(uint64_t n) { g_evaluaciones += n; }
+
 //------------------------------------------------------------------
 // Coeficiente de Jaccard: |H ∩ G| / |H ∪ G|
 //------------------------------------------------------------------
@@ -25,6 +32,7 @@ double M(const Expression& H, const Bitset& G, Metric metric) {
     // Se pueden agregar más métricas aquí
     switch (metric) {
         case Metric::Jaccard:
+            g_evaluaciones++;
             return jaccard_coefficient(H.conjunto, G);
         case Metric::SizeH:
             return static_cast<int>(H.used_sets.size());
@@ -32,4 +40,18 @@ double M(const Expression& H, const Bitset& G, Metric metric) {
             return H.n_ops;
     }
     throw invalid_argument("Métrica no implementada");
-}
\ No newline at end of file
+}
+
+//------------------------------------------------------------------
+// Jaccard por lotes (un H, varios G)
+//------------------------------------------------------------------
+void jaccard_lote(const Bitset& H, const vector<Bitset>& Gs,
+                  const vector<int>& card_G, double* out) {
+    const int card_H = H.count();
+    g_evaluaciones += Gs.size();
+    for (size_t t = 0; t < Gs.size(); t++) {
+        const int intersection = (H & Gs[t]).count();
+        const int union_size = card_H + card_G[t] - intersection;
+        out[t] = (union_size == 0) ? 1.0 : static_cast<double>(intersection) / union_size;
+    }
+}
@@ -0,0 +1,105 @@
+//----------------------------------------------------------------------
+// muestreo.cpp
+//----------------------------------------------------------------------
+// Muestra fija del universo y cota superior del Jaccard.
+//----------------------------------------------------------------------
+
+#include "muestreo.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+using namespace std;
+
+MuestraUniverso crear_muestra(const Bitset& G, const Bitset& U, double delta, uint64_t seed) {
+    if (delta < 0.0 || delta >= 1.0) throw invalid_argument("delta debe estar en [0, 1)");
+    vector<int> en_G, fuera;
+    for (int i = 0; i < U_size; i++) {
+        if (G[i]) en_G.push_back(i);
+        else if (U[i]) fuera.push_back(i);
+    }
+
+    MuestraUniverso m;
+    m.card_G = (int)en_G.size();
+    m.card_fuera = fuera.size();
+    if (en_G.size() <= (size_t)TAM_MUESTRA) {
+        m.elementos = en_G;
+        m.num_G = (int)en_G.size();
+    }
+    const size_t libres = TAM_MUESTRA - m.elementos.size();
+    if (fuera.size() <= libres) {
+        // Todo U \ G: |H \ G| exacto
+        m.elementos.insert(m.elementos.end(), fuera.begin(), fuera.end());
+        m.fuera_completo = true;
+    } else if (delta > 0.0) {
+        // Fisher-Yates parcial sobre U \ G
+        mt19937_64 rng(seed);
+        for (size_t i = 0; i < libres; i++) {
+            uniform_int_distribution<size_t> d(i, fuera.size() - 1);
+            swap(fuera[i], fuera[d(rng)]);
+        }
+        m.elementos.insert(m.elementos.end(), fuera.begin(), fuera.begin() + libres);
+        m.log_delta = log(1.0 / delta);
+    }
+    for (size_t i = 0; i < m.elementos.size(); i++) {
+        if ((int)i < m.num_G) m.G[i] = 1;
+        else m.fuera[i] = 1;
+    }
+    return m;
+}
+
+Muestra proyectar(const Bitset& X, const MuestraUniverso& m) {
+    Muestra r;
+    for (size_t i = 0; i < m.elementos.size(); i++) {
+        if (X[m.elementos[i]]) r[i] = 1;
+    }
+    return r;
+}
+
+ResumenConjunto resumir(const Bitset& X, const Bitset& G, const MuestraUniverso& m) {
+    ResumenConjunto r;
+    r.proy = proyectar(X, m);
+    r.dentro = (int)(X & G).count();
+    r.fuera = (int)X.count() - r.dentro;
+    return r;
+}
+
+double cota_superior_jaccard(int op, const ResumenConjunto& A, const ResumenConjunto& B,
+                             const MuestraUniverso& m) {
+    Muestra p;
+    if (op == 0) p = A.proy | B.proy;
+    else if (op == 1) p = A.proy & B.proy;
+    else p = A.proy & ~B.proy;
+
+    // |H ∩ G|: exacto si G está entero en la muestra
+    double inter;
+    if (m.num_G == m.card_G) inter = (double)(p & m.G).count();
+    else if (op == 0) inter = min(m.card_G, A.dentro + B.dentro);
+    else if (op == 1) inter = min(A.dentro, B.dentro);
+    else inter = A.dentro;
+
+    // |H \ G| por debajo: cardinales de los operandos
+    double fuera;
+    if (op == 0) fuera = max(A.fuera, B.fuera);
+    else if (op == 1) fuera = max(0.0, (double)A.fuera + B.fuera - (double)m.card_fuera);
+    else fuera = max(0, A.fuera - B.fuera);
+
+    const int s = (int)m.elementos.size() - m.num_G;
+    if (s > 0) {
+        const double x = (double)(p & m.fuera).count();
+        if (m.fuera_completo) {
+            fuera = x;
+        } else if (m.log_delta > 0.0) {
+            /* Chernoff: P[X >= (1 + e) mu] <= exp(-e^2 mu / (2 + e)), que
+                también vale sin reemplazo. Menor mu compatible con x. */
+            const double L = m.log_delta;
+            const double mu_inf = max(0.0, ((2.0 * x + L) - sqrt(L * L + 8.0 * x * L)) / 2.0);
+            fuera = max(fuera, mu_inf / s * (double)m.card_fuera);
+        }
+    }
+
+    const double uni = m.card_G + fuera;
+    return uni == 0.0 ? 1.0 : min(1.0, inter / uni);
+}
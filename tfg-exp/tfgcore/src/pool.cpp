@@ -0,0 +1,106 @@
+//----------------------------------------------------------------------
+// pool.cpp
+//----------------------------------------------------------------------
+// Pool de hilos con robo de trabajo (work-stealing).
+//----------------------------------------------------------------------
+
+#include "pool.hpp"
+
+#include <algorithm>
+
+using namespace std;
+
+// Índice del trabajador que ejecuta el hilo actual (-1 fuera del pool)
+static thread_local int t_id_trabajador = -1;
+static thread_local const PoolTrabajo* t_pool = nullptr;
+
+PoolTrabajo::PoolTrabajo(int hilos) {
+    if (hilos <= 0) hilos = (int)max(1u, thread::hardware_concurrency());
+    for (int i = 0; i < hilos; i++) colas_.push_back(make_unique<Cola>());
+    for (int i = 0; i < hilos; i++) hilos_.emplace_back([this, i] { bucle(i); });
+}
+
+PoolTrabajo::~PoolTrabajo() {
+    esperar();
+    {
+        lock_guard<mutex> lk(m_);
+        parar_ = true;
+    }
+    cv_trabajo_.notify_all();
+    for (auto& h : hilos_) h.join();
+}
+
+//------------------------------------------------------------------
+// Encolar
+//------------------------------------------------------------------
+void PoolTrabajo::enviar(function<void()> tarea) {
+    // Desde un trabajador: a su propia cola; desde fuera: round-robin
+    size_t id = (t_pool == this) ? (size_t)t_id_trabajador
+                                 : siguiente_.fetch_add(1) % colas_.size();
+    pendientes_++;
+    {
+        lock_guard<mutex> lk(colas_[id]->m);
+        en_cola_++;
+        colas_[id]->tareas.push_back(move(tarea));
+    }
+    {
+        lock_guard<mutex> lk(m_);
+    }
+    cv_trabajo_.notify_one();
+}
+
+void PoolTrabajo::esperar() {
+    unique_lock<mutex> lk(m_);
+    cv_fin_.wait(lk, [this] { return pendientes_.load() == 0; });
+}
+
+//------------------------------------------------------------------
+// Obtener tarea: propia (LIFO) o robada (FIFO)
+//------------------------------------------------------------------
+bool PoolTrabajo::obtener(int id, function<void()>& tarea) {
+    {
+        Cola& c = *colas_[id];
+        lock_guard<mutex> lk(c.m);
+        if (!c.tareas.empty()) {
+            tarea = move(c.tareas.back());
+            c.tareas.pop_back();
+            en_cola_--;
+            return true;
+        }
+    }
+    const int n = (int)colas_.size();
+    for (int d = 1; d < n; d++) {
+        Cola& c = *colas_[(id + d) % n];
+        lock_guard<mutex> lk(c.m);
+        if (!c.tareas.empty()) {
+            tarea = move(c.tareas.front());
+            c.tareas.pop_front();
+            en_cola_--;
+            return true;
+        }
+    }
+    return false;
+}
+
+//------------------------------------------------------------------
+// Bucle de cada trabajador
+//------------------------------------------------------------------
+void PoolTrabajo::bucle(int id) {
+    t_id_trabajador = id;
+    t_pool = this;
+
+    while (true) {
+        function<void()> tarea;
+        if (obtener(id, tarea)) {
+            tarea();
+            if (--pendientes_ == 0) {
+                lock_guard<mutex> lk(m_);
+                cv_fin_.notify_all();
+            }
+            continue;
+        }
+        unique_lock<mutex> lk(m_);
+        cv_trabajo_.wait(lk, [this] { return parar_ || en_cola_.load() > 0; });
+        if (parar_ && en_cola_.load() == 0) return;
+    }
+}
@@ -0,0 +1,293 @@
+//----------------------------------------------------------------------
+// runner.cpp
+//----------------------------------------------------------------------
+// Ejecución de experimentos por lotes dentro de un único proceso:
+// manifiesto -> lista de ejecuciones -> pool de hilos -> CSV/JSONL.
+//----------------------------------------------------------------------
+
+#include "runner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+#include "exhaustiva.hpp"
+#include "generator.hpp"
+#include "greedy.hpp"
+#include "ground_truth.hpp"
+#include "hibrido.hpp"
+#include "mapelites.hpp"
+#include "indicadores.hpp"
+#include "metrics.hpp"
+#include "pool.hpp"
+
+using namespace std;
+
+//------------------------------------------------------------------
+// Lectura del manifiesto
+//------------------------------------------------------------------
+static string recortar(const string& s) {
+    size_t a = s.find_first_not_of(" \t\r");
+    if (a == string::npos) return "";
+    size_t b = s.find_last_not_of(" \t\r");
+    return s.substr(a, b - a + 1);
+}
+
+// "1000..1003" -> 1000,1001,1002,1003 ; "a,b" -> a,b
+static vector<string> expandir_valores(const string& v) {
+    vector<string> r;
+    stringstream ss(v);
+    string tok;
+    while (getline(ss, tok, ',')) {
+        tok = recortar(tok);
+        if (tok.empty()) continue;
+        size_t p = tok.find("..");
+        if (p != string::npos) {
+            long long a = stoll(tok.substr(0, p)), b = stoll(tok.substr(p + 2));
+            for (long long x = a; x <= b; x++) r.push_back(to_string(x));
+        } else {
+            r.push_back(tok);
+        }
+    }
+    return r;
+}
+
+// Aplica una clave del manifiesto a la configuración
+static void aplicar_clave(ConfigEjecucion& c, const string& clave, const string& v, bool& seed_expr_fijada) {
+    if (clave == "modo") {
+        if (v != "test" && v != "groundtruth") throw invalid_argument("Modo desconocido: " + v);
+        c.modo_test = (v == "test");
+    }
+    else if (clave == "seeds" || clave == "seed") c.seed = stoi(v);
+    else if (clave == "k") c.k = stoi(v);
+    else if (clave == "algo") {
+        if (v != "exhaustiva" && v != "greedy" && v != "genetico" && v != "hibrido" && v != "mapelites") throw invalid_argument("Algoritmo desconocido: " + v);
+        c.algo = v;
+    }
+    else if (clave == "G") c.G_size_min = stoi(v);
+    else if (clave == "Fmin") c.F_n_min = stoi(v);
+    else if (clave == "Fmax") c.F_n_max = stoi(v);
+    else if (clave == "FsizeMin") c.Fi_size_min = stoi(v);
+    else if (clave == "FsizeMax") c.Fi_size_max = stoi(v);
+    else if (clave == "pop_size") c.ga.population_size = stoi(v);
+    else if (clave == "mutation_prob") c.ga.mutation_prob = stod(v);
+    else if (clave == "crossover_prob") c.ga.crossover_prob = stod(v);
+    else if (clave == "tournament_size") c.ga.tournament_size = stoi(v);
+    else if (clave == "max_generations") c.ga.max_generations = stoi(v);
+    else if (clave == "time_limit") c.ga.time_limit_sec = stoi(v);
+    else if (clave == "seed_expr") {
+        c.ga.seed = stoull(v);
+        seed_expr_fijada = true;
+    }
+    else throw invalid_argument("Clave de manifiesto desconocida: " + clave);
+}
+
+vector<ConfigEjecucion> leer_manifiesto(const string& path) {
+    ifstream in(path);
+    if (!in) throw runtime_error("No se pudo abrir el manifiesto " + path);
+
+    // Claves en orden de aparición con sus listas de valores
+    vector<pair<string, vector<string>>> claves;
+    string linea;
+    while (getline(in, linea)) {
+        linea = recortar(linea.substr(0, linea.find('#')));
+        if (linea.empty()) continue;
+        size_t eq = linea.find('=');
+        if (eq == string::npos) throw invalid_argument("Línea de manifiesto inválida: " + linea);
+        string clave = recortar(linea.substr(0, eq));
+        vector<string> valores = expandir_valores(linea.substr(eq + 1));
+        if (valores.empty()) throw invalid_argument("Clave sin valores: " + clave);
+        claves.emplace_back(clave, valores);
+    }
+
+    // Producto cartesiano de todas las claves
+    vector<ConfigEjecucion> r;
+    vector<size_t> idx(claves.size(), 0);
+    while (true) {
+        ConfigEjecucion c;
+        c.ga.population_size = 150;     // Valores por defecto de main
+        c.ga.mutation_prob = 0.5;
+        c.ga.tournament_size = 5;
+        c.ga.time_limit_sec = 900;
+        bool seed_expr_fijada = false;
+        for (size_t i = 0; i < claves.size(); i++) {
+            aplicar_clave(c, claves[i].first, claves[i].second[idx[i]], seed_expr_fijada);
+        }
+        // Sin seed_expr explícita, la semilla del GA es la de la instancia (reproducible)
+        if (!seed_expr_fijada) c.ga.seed = (uint64_t)c.seed;
+        c.id = (int)r.size();
+        r.push_back(c);
+
+        // Siguiente combinación (la última clave varía más rápido)
+        int i = (int)claves.size() - 1;
+        while (i >= 0 && ++idx[i] == claves[i].second.size()) {
+            idx[i] = 0;
+            i--;
+        }
+        if (i < 0) break;
+    }
+    return r;
+}
+
+//------------------------------------------------------------------
+// Ejecución de una configuración
+//------------------------------------------------------------------
+template<typename T>
+static void resumir(const vector<T>& frente, int k, ResultadoEjecucion& r) {
+    r.num_pareto = (int)frente.size();
+    r.mejor_jaccard = 0.0;
+    for (const auto& s : frente) r.mejor_jaccard = max(r.mejor_jaccard, s.jaccard);
+    r.hipervolumen = hipervolumen(frente, k, r.F_count);
+    if (!r.cfg.modo_test) {
+        r.hit = any_of(frente.begin(), frente.end(), [](const T& s) { return s.jaccard == 1.0; }) ? 1 : 0;
+    }
+}
+
+ResultadoEjecucion ejecutar_configuracion(const ConfigEjecucion& cfg) {
+    ResultadoEjecucion r;
+    r.cfg = cfg;
+
+    Bitset U;
+    U.set();
+
+    // Instancia
+    Bitset G;
+    vector<Bitset> F;
+    if (cfg.modo_test) {
+        G = generar_G(U_size, cfg.G_size_min, cfg.seed);
+        F = generar_F(U_size, cfg.F_n_min, cfg.F_n_max, cfg.Fi_size_min, cfg.Fi_size_max, cfg.seed);
+    } else {
+        auto gt = make_groundtruth(U, U_size, cfg.F_n_min, cfg.F_n_max,
+                                   cfg.Fi_size_min, cfg.Fi_size_max, cfg.k, cfg.seed);
+        G = gt.G;
+        F = move(gt.F);
+    }
+    r.G_size = (int)G.count();
+    r.F_count = (int)F.size();
+
+    // Algoritmo
+    reiniciar_evaluaciones();
+    auto t0 = chrono::steady_clock::now();
+    if (cfg.algo == "exhaustiva") {
+        auto frente = exhaustive_search(F, U, G, cfg.k);
+        r.tiempo_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+        resumir(frente, cfg.k, r);
+    } else if (cfg.algo == "greedy") {
+        auto frente = greedy_multiobjective_search(F, U, G, cfg.k);
+        r.tiempo_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+        resumir(frente, cfg.k, r);
+    } else if (cfg.algo == "hibrido") {
+        HibridoParams hp;
+        hp.ga = cfg.ga;
+        auto frente = hibrido(F, U, G, cfg.k, hp);
+        r.tiempo_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+        resumir(frente, cfg.k, r);
+    } else if (cfg.algo == "mapelites") {
+        MapElitesParams mp;
+        mp.max_lotes = cfg.ga.max_generations;
+        mp.time_limit_sec = cfg.ga.time_limit_sec;
+        mp.crossover_prob = cfg.ga.crossover_prob;
+        mp.mutation_prob = cfg.ga.mutation_prob;
+        mp.simplificar = cfg.ga.simplificar;
+        mp.seed = cfg.ga.seed;
+        mp.hilos = 1; // ya estamos en un trabajador del pool del manifiesto
+        auto res = map_elites(F, U, G, cfg.k, mp);
+        r.tiempo_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+        resumir(res.archivo.elites(), cfg.k, r);
+    } else {
+        auto frente = nsga2(F, U, G, cfg.k, cfg.ga);
+        r.tiempo_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+        resumir(frente, cfg.k, r);
+    }
+    r.evaluaciones = evaluaciones_realizadas();
+    return r;
+}
+
+//------------------------------------------------------------------
+// Escritura de filas
+//------------------------------------------------------------------
+static const char* CABECERA_CSV =
+    "id,modo,seed,k,algo,pop_size,mutation_prob,crossover_prob,tournament_size,"
+    "max_generations,time_limit,seed_expr,G_size,F_count,tiempo_ms,evaluaciones,"
+    "num_pareto,mejor_jaccard,hipervolumen,hit,error";
+
+static string escapar_json(const string& s) {
+    string r;
+    for (char ch : s) {
+        if (ch == '"' || ch == '\\') r += '\\';
+        if (ch == '\n') { r += "\\n"; continue; }
+        r += ch;
+    }
+    return r;
+}
+
+static string fila(const ResultadoEjecucion& r, bool json) {
+    const auto& c = r.cfg;
+    ostringstream o;
+    o.precision(10);
+    if (!json) {
+        string err = r.error;
+        replace(err.begin(), err.end(), ',', ';');
+        o << c.id << ',' << (c.modo_test ? "test" : "groundtruth") << ',' << c.seed << ',' << c.k << ','
+          << c.algo << ',' << c.ga.population_size << ',' << c.ga.mutation_prob << ','
+          << c.ga.crossover_prob << ',' << c.ga.tournament_size << ',' << c.ga.max_generations << ','
+          << c.ga.time_limit_sec << ',' << c.ga.seed << ',' << r.G_size << ',' << r.F_count << ','
+          << r.tiempo_ms << ',' << r.evaluaciones << ',' << r.num_pareto << ',' << r.mejor_jaccard << ','
+          << r.hipervolumen << ',' << r.hit << ',' << err;
+    } else {
+        o << "{\"id\":" << c.id << ",\"modo\":\"" << (c.modo_test ? "test" : "groundtruth")
+          << "\",\"seed\":" << c.seed << ",\"k\":" << c.k << ",\"algo\":\"" << c.algo
+          << "\",\"pop_size\":" << c.ga.population_size << ",\"mutation_prob\":" << c.ga.mutation_prob
+          << ",\"crossover_prob\":" << c.ga.crossover_prob << ",\"tournament_size\":" << c.ga.tournament_size
+          << ",\"max_generations\":" << c.ga.max_generations << ",\"time_limit\":" << c.ga.time_limit_sec
+          << ",\"seed_expr\":" << c.ga.seed << ",\"G_size\":" << r.G_size << ",\"F_count\":" << r.F_count
+          << ",\"tiempo_ms\":" << r.tiempo_ms << ",\"evaluaciones\":" << r.evaluaciones
+          << ",\"num_pareto\":" << r.num_pareto << ",\"mejor_jaccard\":" << r.mejor_jaccard
+          << ",\"hipervolumen\":" << r.hipervolumen << ",\"hit\":" << r.hit
+          << ",\"error\":\"" << escapar_json(r.error) << "\"}";
+    }
+    return o.str();
+}
+
+//------------------------------------------------------------------
+// Ejecución del manifiesto en el pool
+//------------------------------------------------------------------
+int ejecutar_manifiesto(const vector<ConfigEjecucion>& ejecuciones,
+                        const string& path_resultados,
+                        const string& formato,
+                        int hilos)
+{
+    if (formato != "csv" && formato != "jsonl") throw invalid_argument("Formato de resultados desconocido: " + formato);
+    const bool json = (formato == "jsonl");
+
+    ofstream out(path_resultados);
+    if (!out) throw runtime_error("No se pudo crear " + path_resultados);
+    if (!json) out << CABECERA_CSV << "\n";
+
+    mutex m_salida;
+    int errores = 0;
+    {
+        PoolTrabajo pool(hilos);
+        for (const auto& cfg : ejecuciones) {
+            pool.enviar([&, cfg] {
+                ResultadoEjecucion r;
+                try {
+                    r = ejecutar_configuracion(cfg);
+                } catch (const exception& e) {
+                    r.cfg = cfg;
+                    r.error = e.what();
+                }
+                // Cada fila se escribe (y vuelca) en cuanto termina su ejecución
+                lock_guard<mutex> lk(m_salida);
+                if (!r.error.empty()) errores++;
+                out << fila(r, json) << "\n";
+                out.flush();
+            });
+        }
+        pool.esperar();
+    }
+    return errores;
+}
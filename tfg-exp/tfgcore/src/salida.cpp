@@ -0,0 +1,277 @@
+//----------------------------------------------------------------------
+// salida.cpp
+//----------------------------------------------------------------------
+// Escritura de resultados legibles por máquina (JSON, CSV, binario)
+// y del volcado de texto de instancias.
+//----------------------------------------------------------------------
+
+#include "salida.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+
+#include "instance_io.hpp"
+
+using namespace std;
+
+//------------------------------------------------------------------
+// Utilidades de composición
+//------------------------------------------------------------------
+static void anadir_entero(string& out, long long v) {
+    char buf[24];
+    auto r = to_chars(buf, buf + sizeof(buf), v);
+    out.append(buf, r.ptr);
+}
+
+// Doble con precisión suficiente para reconstruir el valor exacto
+static void anadir_doble(string& out, double v) {
+    char buf[32];
+    int n = snprintf(buf, sizeof(buf), "%.17g", v);
+    out.append(buf, (size_t)n);
+}
+
+template<typename V>
+static void anadir_binario(string& out, V v) {
+    out.append(reinterpret_cast<const char*>(&v), sizeof(v));
+}
+
+// Elementos del conjunto separados por 'sep' (con 'sep' final si final = true)
+static void anadir_elementos(string& out, const Bitset& b, char sep, bool final) {
+    bool primero = true;
+#if defined(TFG_CONJUNTO_COMPRIMIDO)
+    for (size_t i = b.siguiente(0); i < b.size(); i = b.siguiente(i + 1)) {
+#elif defined(__GLIBCXX__)
+    for (size_t i = b._Find_first(); i < b.size(); i = b._Find_next(i)) {
+#else
+    for (size_t i = 0; i < b.size(); i++) {
+        if (!b[i]) continue;
+#endif
+        if (!primero && !final) out += sep;
+        anadir_entero(out, (long long)i);
+        if (final) out += sep;
+        primero = false;
+    }
+}
+
+void anadir_json_texto(string& out, const string& s) {
+    out += '"';
+    for (char ch : s) {
+        if (ch == '"' || ch == '\\') out += '\\';
+        if (ch == '\n') { out += "\\n"; continue; }
+        out += ch;
+    }
+    out += '"';
+}
+
+static void anadir_csv_texto(string& out, const string& s) {
+    out += '"';
+    for (char ch : s) {
+        if (ch == '"') out += '"';
+        out += ch;
+    }
+    out += '"';
+}
+
+void anadir_solucion_json(string& out, const SolMO& s, bool con_expresion) {
+    out += "{\"n_ops\":";
+    anadir_entero(out, s.n_ops);
+    out += ",\"sizeH\":";
+    anadir_entero(out, s.sizeH);
+    out += ",\"jaccard\":";
+    anadir_doble(out, s.jaccard);
+    if (con_expresion) {
+        out += ",\"expr\":";
+        anadir_json_texto(out, s.expr.expr_str);
+    }
+    out += '}';
+}
+
+//------------------------------------------------------------------
+// Formato y escritura
+//------------------------------------------------------------------
+FormatoSalida leer_formato_salida(const string& s) {
+    if (s == "text") return FormatoSalida::Texto;
+    if (s == "json") return FormatoSalida::JSON;
+    if (s == "csv") return FormatoSalida::CSV;
+    if (s == "bin") return FormatoSalida::Binario;
+    throw invalid_argument("Formato de salida desconocido: " + s);
+}
+
+void escribir_buffer(const string& buffer, const string& path) {
+    if (path == "-") {
+        // Directo a stdout: no depende del estado de std::cout (--quiet)
+        cout.flush();
+        fwrite(buffer.data(), 1, buffer.size(), stdout);
+        fflush(stdout);
+        return;
+    }
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) throw runtime_error("No se pudo crear " + path);
+    size_t escrito = fwrite(buffer.data(), 1, buffer.size(), f);
+    if (fclose(f) != 0 || escrito != buffer.size()) throw runtime_error("Error al escribir " + path);
+}
+
+void anadir_conjuntos_texto(string& out, const Bitset& G, const vector<Bitset>& F) {
+    out += "=== CONJUNTOS ===\nCONJUNTO_G: ";
+    anadir_elementos(out, G, ',', true);
+    out += "\n\nNUM_CONJUNTOS_F: ";
+    anadir_entero(out, (long long)F.size());
+    out += '\n';
+    for (size_t j = 0; j < F.size(); ++j) {
+        out += 'F';
+        anadir_entero(out, (long long)j);
+        out += ": ";
+        anadir_elementos(out, F[j], ',', true);
+        out += '\n';
+    }
+    out += '\n';
+}
+
+//------------------------------------------------------------------
+// Escritor de resultados
+//------------------------------------------------------------------
+EscritorResultados::EscritorResultados(FormatoSalida formato, uint64_t semilla, uint64_t universo,
+                                       bool con_expresiones)
+    : formato_(formato), universo_(min(universo, (uint64_t)U_size)), con_expresiones_(con_expresiones) {
+    cabecera(semilla);
+}
+
+void EscritorResultados::cabecera(uint64_t semilla) {
+    switch (formato_) {
+    case FormatoSalida::Texto:
+        buffer_ += "Semilla: " + to_string(semilla) + "\nU_size: " + to_string(universo_) + "\n";
+        break;
+    case FormatoSalida::JSON:
+        buffer_ += "{\"semilla\":" + to_string(semilla) + ",\"u_size\":" + to_string(universo_);
+        break;
+    case FormatoSalida::CSV:
+        buffer_ += "seccion,nombre,tiempo_ms,n_ops,sizeH,jaccard,valor\n";
+        break;
+    case FormatoSalida::Binario:
+        buffer_.append("TFGRES1\0", 8);
+        anadir_binario<uint64_t>(buffer_, semilla);
+        anadir_binario<uint32_t>(buffer_, (uint32_t)universo_);
+        break;
+    }
+}
+
+void EscritorResultados::instancia(const Bitset& G, const vector<Bitset>& F) {
+    switch (formato_) {
+    case FormatoSalida::Texto:
+        anadir_conjuntos_texto(buffer_, G, F);
+        break;
+    case FormatoSalida::JSON:
+        buffer_ += ",\"instancia\":{\"G\":[";
+        anadir_elementos(buffer_, G, ',', false);
+        buffer_ += "],\"F\":[";
+        for (size_t j = 0; j < F.size(); j++) {
+            if (j) buffer_ += ',';
+            buffer_ += '[';
+            anadir_elementos(buffer_, F[j], ',', false);
+            buffer_ += ']';
+        }
+        buffer_ += "]}";
+        break;
+    case FormatoSalida::CSV:
+        for (size_t j = 0; j <= F.size(); j++) {
+            buffer_ += (j == 0) ? "conjunto,G,,,,,\"" : "conjunto,F" + to_string(j - 1) + ",,,,,\"";
+            anadir_elementos(buffer_, j == 0 ? G : F[j - 1], ' ', false);
+            buffer_ += "\"\n";
+        }
+        break;
+    case FormatoSalida::Binario: {
+        const uint32_t wpc = (uint32_t)palabras_para(universo_);
+        buffer_ += (char)1;
+        anadir_binario<uint32_t>(buffer_, (uint32_t)F.size());
+        anadir_binario<uint32_t>(buffer_, wpc);
+        auto w = bitset_a_palabras(G, universo_);
+        buffer_.append(reinterpret_cast<const char*>(w.data()), wpc * sizeof(uint64_t));
+        for (const auto& Fi : F) {
+            w = bitset_a_palabras(Fi, universo_);
+            buffer_.append(reinterpret_cast<const char*>(w.data()), wpc * sizeof(uint64_t));
+        }
+        break;
+    }
+    }
+}
+
+void EscritorResultados::abrir_frente(const string& algoritmo, long long tiempo_ms, size_t n) {
+    switch (formato_) {
+    case FormatoSalida::Texto:
+        buffer_ += "=== " + algoritmo + " ===\nTiempo_ejecucion_ms: " + to_string(tiempo_ms) + "\n\n";
+        buffer_ += "\n=== FRENTE DE PARETO ===\nTotal soluciones no dominadas: " + to_string(n) + "\n\n";
+        break;
+    case FormatoSalida::JSON:
+        buffer_ += (num_frentes_ == 0) ? ",\"frentes\":[" : ",";
+        buffer_ += "{\"algoritmo\":";
+        anadir_json_texto(buffer_, algoritmo);
+        buffer_ += ",\"tiempo_ms\":";
+        anadir_entero(buffer_, tiempo_ms);
+        buffer_ += ",\"soluciones\":[";
+        break;
+    case FormatoSalida::CSV:
+        nombre_frente_ = algoritmo;
+        tiempo_frente_ = tiempo_ms;
+        break;
+    case FormatoSalida::Binario:
+        buffer_ += (char)2;
+        anadir_binario<uint32_t>(buffer_, (uint32_t)algoritmo.size());
+        buffer_ += algoritmo;
+        anadir_binario<int64_t>(buffer_, tiempo_ms);
+        anadir_binario<uint32_t>(buffer_, (uint32_t)n);
+        break;
+    }
+    num_frentes_++;
+}
+
+void EscritorResultados::solucion(const SolMO& s, size_t i) {
+    switch (formato_) {
+    case FormatoSalida::Texto:
+        anadir_solucion_texto(buffer_, s, i);
+        break;
+    case FormatoSalida::JSON:
+        if (i) buffer_ += ',';
+        anadir_solucion_json(buffer_, s, con_expresiones_);
+        break;
+    case FormatoSalida::CSV:
+        buffer_ += "solucion,";
+        buffer_ += nombre_frente_;
+        buffer_ += ',';
+        anadir_entero(buffer_, tiempo_frente_);
+        buffer_ += ',';
+        anadir_entero(buffer_, s.n_ops);
+        buffer_ += ',';
+        anadir_entero(buffer_, s.sizeH);
+        buffer_ += ',';
+        anadir_doble(buffer_, s.jaccard);
+        buffer_ += ',';
+        if (con_expresiones_) anadir_csv_texto(buffer_, s.expr.expr_str);
+        buffer_ += '\n';
+        break;
+    case FormatoSalida::Binario: {
+        anadir_binario<int32_t>(buffer_, s.n_ops);
+        anadir_binario<int32_t>(buffer_, s.sizeH);
+        anadir_binario<double>(buffer_, s.jaccard);
+        uint32_t len = con_expresiones_ ? (uint32_t)s.expr.expr_str.size() : 0;
+        anadir_binario<uint32_t>(buffer_, len);
+        buffer_.append(s.expr.expr_str.data(), len);
+        break;
+    }
+    }
+}
+
+void EscritorResultados::cerrar_frente() {
+    if (formato_ == FormatoSalida::JSON) buffer_ += "]}";
+}
+
+void EscritorResultados::volcar(const string& path) {
+    if (formato_ == FormatoSalida::JSON) {
+        if (num_frentes_ > 0) buffer_ += ']';
+        buffer_ += "}\n";
+    }
+    escribir_buffer(buffer_, path);
+    buffer_.clear();
+}
@@ -0,0 +1,353 @@
+//----------------------------------------------------------------------
+// sat.cpp
+//----------------------------------------------------------------------
+// Resolutor SAT CDCL mínimo.
+//----------------------------------------------------------------------
+
+#include "sat.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+// Decaimiento de las actividades (VSIDS) y conflictos por unidad de Luby
+static const double DECAIMIENTO = 0.95;
+static const int UNIDAD_REINICIO = 100;
+
+// Secuencia de Luby: 1 1 2 1 1 2 4 1 1 2 ...
+static double luby(double y, int x) {
+    int tam = 1, seq = 0;
+    while (tam < x + 1) {
+        seq++;
+        tam = 2 * tam + 1;
+    }
+    while (tam - 1 != x) {
+        tam = (tam - 1) >> 1;
+        seq--;
+        x = x % tam;
+    }
+    return pow(y, seq);
+}
+
+//------------------------------------------------------------------
+// Variables y cláusulas
+//------------------------------------------------------------------
+int SolverSAT::nueva_variable() {
+    const int v = (int)asignacion.size();
+    asignacion.push_back(-1);
+    fase.push_back(-1);
+    nivel.push_back(0);
+    razon.push_back(-1);
+    visto.push_back(0);
+    actividad.push_back(0.0);
+    pos_monticulo.push_back(-1);
+    vigilantes.emplace_back();
+    vigilantes.emplace_back();
+    mont_insertar(v);
+    return v + 1;
+}
+
+bool SolverSAT::anadir_clausula(vector<int> lits) {
+    if (!ok) return false;
+    for (int& l : lits) l = interno(l);
+    sort(lits.begin(), lits.end());
+
+    // Quitar repetidos y literales falsos en el nivel 0; descartar si es tautología o ya se cumple
+    size_t j = 0;
+    for (size_t i = 0; i < lits.size(); i++) {
+        const int p = lits[i];
+        if (j > 0 && lits[j - 1] == p) continue;
+        if (j > 0 && lits[j - 1] == (p ^ 1)) return true;
+        const int vl = valor_lit(p);
+        if (vl == 1) return true;
+        if (vl == 0) continue;
+        lits[j++] = p;
+    }
+    lits.resize(j);
+    num_originales++;
+
+    if (lits.empty()) return ok = false;
+    if (lits.size() == 1) {
+        asignar(lits[0], -1);
+        return ok = (propagar() < 0);
+    }
+    clausulas.push_back(move(lits));
+    vigilar((int)clausulas.size() - 1);
+    return true;
+}
+
+void SolverSAT::vigilar(int c) {
+    vigilantes[clausulas[c][0]].push_back(c);
+    vigilantes[clausulas[c][1]].push_back(c);
+}
+
+//------------------------------------------------------------------
+// Asignación y propagación unitaria
+//------------------------------------------------------------------
+void SolverSAT::asignar(int p, int r) {
+    const int v = var_de(p);
+    asignacion[v] = (int8_t)((p & 1) ^ 1);
+    nivel[v] = nivel_actual();
+    razon[v] = r;
+    traza.push_back(p);
+}
+
+int SolverSAT::propagar() {
+    while (cabeza < traza.size()) {
+        const int falso = traza[cabeza++] ^ 1;
+        stats.propagaciones++;
+        vector<int>& ws = vigilantes[falso];
+        size_t i = 0, j = 0;
+        while (i < ws.size()) {
+            const int c = ws[i++];
+            vector<int>& cl = clausulas[c];
+            if (cl[0] == falso) swap(cl[0], cl[1]);
+            if (valor_lit(cl[0]) == 1) {
+                ws[j++] = c;
+                continue;
+            }
+
+            // Buscar otro literal que vigilar
+            bool movido = false;
+            for (size_t q = 2; q < cl.size(); q++) {
+                if (valor_lit(cl[q]) != 0) {
+                    swap(cl[1], cl[q]);
+                    vigilantes[cl[1]].push_back(c);
+                    movido = true;
+                    break;
+                }
+            }
+            if (movido) continue;
+
+            ws[j++] = c;
+            if (valor_lit(cl[0]) == 0) {
+                // Conflicto: conservar el resto de vigilantes
+                while (i < ws.size()) ws[j++] = ws[i++];
+                ws.resize(j);
+                cabeza = traza.size();
+                return c;
+            }
+            asignar(cl[0], c);
+        }
+        ws.resize(j);
+    }
+    return -1;
+}
+
+//------------------------------------------------------------------
+// Análisis de conflictos (primer UIP)
+//------------------------------------------------------------------
+void SolverSAT::analizar(int conflicto, vector<int>& aprendida, int& nivel_vuelta) {
+    aprendida.assign(1, -1);
+    int pendientes = 0;
+    int p = -1;
+    int idx = (int)traza.size() - 1;
+    int c = conflicto;
+    do {
+        const vector<int>& cl = clausulas[c];
+        for (size_t j = (p == -1 ? 0 : 1); j < cl.size(); j++) {
+            const int q = cl[j];
+            const int v = var_de(q);
+            if (visto[v] || nivel[v] == 0) continue;
+            aumentar(v);
+            visto[v] = 1;
+            if (nivel[v] >= nivel_actual()) pendientes++;
+            else aprendida.push_back(q);
+        }
+        while (!visto[var_de(traza[idx])]) idx--;
+        p = traza[idx--];
+        c = razon[var_de(p)];
+        visto[var_de(p)] = 0;
+        pendientes--;
+    } while (pendientes > 0);
+    aprendida[0] = p ^ 1;
+
+    // Minimización local: fuera los literales implicados por el resto
+    const vector<int> original = aprendida;
+    size_t j = 1;
+    for (size_t i = 1; i < aprendida.size(); i++) {
+        if (!redundante(aprendida[i])) aprendida[j++] = aprendida[i];
+    }
+    aprendida.resize(j);
+    for (int q : original) visto[var_de(q)] = 0;
+
+    // Nivel de vuelta: el mayor nivel del resto, que pasa a la posición 1
+    nivel_vuelta = 0;
+    if (aprendida.size() > 1) {
+        size_t max_i = 1;
+        for (size_t i = 2; i < aprendida.size(); i++) {
+            if (nivel[var_de(aprendida[i])] > nivel[var_de(aprendida[max_i])]) max_i = i;
+        }
+        swap(aprendida[1], aprendida[max_i]);
+        nivel_vuelta = nivel[var_de(aprendida[1])];
+    }
+}
+
+bool SolverSAT::redundante(int p) const {
+    const int r = razon[var_de(p)];
+    if (r < 0) return false;
+    const vector<int>& cl = clausulas[r];
+    for (size_t k = 1; k < cl.size(); k++) {
+        const int v = var_de(cl[k]);
+        if (!visto[v] && nivel[v] > 0) return false;
+    }
+    return true;
+}
+
+void SolverSAT::retroceder(int n) {
+    if (nivel_actual() <= n) return;
+    for (int i = (int)traza.size() - 1; i >= limites_traza[n]; i--) {
+        const int v = var_de(traza[i]);
+        fase[v] = asignacion[v];
+        asignacion[v] = -1;
+        razon[v] = -1;
+        if (pos_monticulo[v] < 0) mont_insertar(v);
+    }
+    traza.resize(limites_traza[n]);
+    limites_traza.resize(n);
+    cabeza = traza.size();
+}
+
+//------------------------------------------------------------------
+// Heurística de decisión (VSIDS)
+//------------------------------------------------------------------
+void SolverSAT::aumentar(int v) {
+    if ((actividad[v] += incremento) > 1e100) {
+        for (double& a : actividad) a *= 1e-100;
+        incremento *= 1e-100;
+    }
+    if (pos_monticulo[v] >= 0) mont_subir(pos_monticulo[v]);
+}
+
+int SolverSAT::elegir_literal() {
+    while (!monticulo.empty()) {
+        const int v = mont_extraer();
+        if (asignacion[v] < 0) return 2 * v + (fase[v] == 1 ? 0 : 1);
+    }
+    return -1;
+}
+
+void SolverSAT::mont_insertar(int v) {
+    pos_monticulo[v] = (int)monticulo.size();
+    monticulo.push_back(v);
+    mont_subir(pos_monticulo[v]);
+}
+
+void SolverSAT::mont_subir(int i) {
+    const int v = monticulo[i];
+    while (i > 0) {
+        const int padre = (i - 1) / 2;
+        if (actividad[monticulo[padre]] >= actividad[v]) break;
+        monticulo[i] = monticulo[padre];
+        pos_monticulo[monticulo[i]] = i;
+        i = padre;
+    }
+    monticulo[i] = v;
+    pos_monticulo[v] = i;
+}
+
+void SolverSAT::mont_bajar(int i) {
+    const int v = monticulo[i];
+    const int n = (int)monticulo.size();
+    for (;;) {
+        int hijo = 2 * i + 1;
+        if (hijo >= n) break;
+        if (hijo + 1 < n && actividad[monticulo[hijo + 1]] > actividad[monticulo[hijo]]) hijo++;
+        if (actividad[monticulo[hijo]] <= actividad[v]) break;
+        monticulo[i] = monticulo[hijo];
+        pos_monticulo[monticulo[i]] = i;
+        i = hijo;
+    }
+    monticulo[i] = v;
+    pos_monticulo[v] = i;
+}
+
+int SolverSAT::mont_extraer() {
+    const int v = monticulo[0];
+    pos_monticulo[v] = -1;
+    monticulo[0] = monticulo.back();
+    monticulo.pop_back();
+    if (!monticulo.empty()) {
+        pos_monticulo[monticulo[0]] = 0;
+        mont_bajar(0);
+    }
+    return v;
+}
+
+//------------------------------------------------------------------
+// Búsqueda
+//------------------------------------------------------------------
+EstadoSAT SolverSAT::buscar(long long max_conflictos, const vector<int>& supuestos, long long& presupuesto) {
+    long long conflictos = 0;
+    vector<int> aprendida;
+    for (;;) {
+        const int conflicto = propagar();
+        if (conflicto >= 0) {
+            stats.conflictos++;
+            conflictos++;
+            if (presupuesto > 0) presupuesto--;
+            if (nivel_actual() == 0) {
+                ok = false;
+                return EstadoSAT::UNSAT;
+            }
+            int nivel_vuelta;
+            analizar(conflicto, aprendida, nivel_vuelta);
+            retroceder(nivel_vuelta);
+            if (aprendida.size() == 1) {
+                asignar(aprendida[0], -1);
+            } else {
+                clausulas.push_back(aprendida);
+                const int c = (int)clausulas.size() - 1;
+                vigilar(c);
+                asignar(aprendida[0], c);
+                stats.aprendidas++;
+            }
+            incremento /= DECAIMIENTO;
+            continue;
+        }
+
+        if (conflictos >= max_conflictos || presupuesto == 0) {
+            retroceder(0);
+            return EstadoSAT::DESCONOCIDO;
+        }
+
+        // Supuestos primero, un nivel de decisión por supuesto
+        int siguiente = -1;
+        while (nivel_actual() < (int)supuestos.size()) {
+            const int p = interno(supuestos[nivel_actual()]);
+            const int vl = valor_lit(p);
+            if (vl == 1) limites_traza.push_back((int)traza.size());
+            else if (vl == 0) return EstadoSAT::UNSAT;
+            else {
+                siguiente = p;
+                break;
+            }
+        }
+        if (siguiente < 0) {
+            siguiente = elegir_literal();
+            if (siguiente < 0) {
+                modelo = asignacion;
+                return EstadoSAT::SAT;
+            }
+            stats.decisiones++;
+        }
+        limites_traza.push_back((int)traza.size());
+        asignar(siguiente, -1);
+    }
+}
+
+EstadoSAT SolverSAT::resolver(const vector<int>& supuestos, long long max_conflictos) {
+    modelo.clear();
+    if (!ok) return EstadoSAT::UNSAT;
+    long long presupuesto = max_conflictos < 0 ? -1 : max_conflictos;
+    EstadoSAT e = EstadoSAT::DESCONOCIDO;
+    for (int i = 0; e == EstadoSAT::DESCONOCIDO; i++) {
+        e = buscar((long long)(luby(2.0, i) * UNIDAD_REINICIO), supuestos, presupuesto);
+        if (e != EstadoSAT::DESCONOCIDO) break;
+        stats.reinicios++;
+        if (presupuesto == 0) break;
+    }
+    retroceder(0);
+    return e;
+}
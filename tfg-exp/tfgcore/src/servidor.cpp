@@ -0,0 +1,350 @@
+//----------------------------------------------------------------------
+// servidor.cpp
+//----------------------------------------------------------------------
+// Modo servidor: instancias residentes y peticiones por stdin o por
+// un socket Unix, resueltas en un pool de hilos.
+//----------------------------------------------------------------------
+
+#include "servidor.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include "generator.hpp"
+#include "genetico.hpp"
+#include "greedy.hpp"
+#include "instance_io.hpp"
+#include "salida.hpp"
+
+#if !defined(_WIN32)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+//------------------------------------------------------------------
+// Conexión: destino de las respuestas (stdout o un socket)
+//------------------------------------------------------------------
+struct Servidor::Conexion {
+    int fd = -1;            // -1: stdout
+    mutex m;
+
+    // Las tareas en curso mantienen viva la conexión hasta responder
+    ~Conexion() {
+#if !defined(_WIN32)
+        if (fd >= 0) ::close(fd);
+#endif
+    }
+
+    void escribir(string linea) {
+        linea += '\n';
+        lock_guard<mutex> lk(m);
+        if (fd < 0) {
+            fwrite(linea.data(), 1, linea.size(), stdout);
+            fflush(stdout);
+            return;
+        }
+#if !defined(_WIN32)
+        size_t hecho = 0;
+        while (hecho < linea.size()) {
+            ssize_t n = ::write(fd, linea.data() + hecho, linea.size() - hecho);
+            if (n <= 0) return;     // Cliente desconectado: se descarta la respuesta
+            hecho += (size_t)n;
+        }
+#endif
+    }
+};
+
+static string respuesta_error(const string& id, const string& mensaje) {
+    string r = "{\"id\":";
+    anadir_json_texto(r, id);
+    r += ",\"estado\":\"error\",\"mensaje\":";
+    anadir_json_texto(r, mensaje);
+    r += '}';
+    return r;
+}
+
+//------------------------------------------------------------------
+// Instancias
+//------------------------------------------------------------------
+Servidor::Servidor(int hilos, uint64_t max_bytes_tablas) : pool_(hilos), max_bytes_tablas_(max_bytes_tablas) {}
+
+void Servidor::registrar_instancia(const string& nombre, vector<Bitset> F, const Bitset& U) {
+    auto inst = make_shared<InstanciaServidor>();
+    inst->F = move(F);
+    inst->U = U;
+    inst->universo = (int)U.count();
+    inst->atomos = construir_atomos(inst->F, inst->U);
+    inst->bloques_greedy = bloques_base_greedy(inst->F, inst->U, Bitset());
+    inst->bloques_ga = construir_bloques_base(inst->F, inst->U, Bitset());
+
+    lock_guard<mutex> lk(m_instancias_);
+    instancias_[nombre] = inst;
+}
+
+shared_ptr<InstanciaServidor> Servidor::buscar(const string& nombre) {
+    lock_guard<mutex> lk(m_instancias_);
+    auto it = instancias_.find(nombre);
+    if (it == instancias_.end()) throw invalid_argument("Instancia desconocida: " + nombre);
+    return it->second;
+}
+
+/* La tabla se construye fuera del cerrojo; si dos peticiones la piden
+    a la vez, se queda la primera que termine. Su memoria se reserva
+    antes de construirla, así que las que están en curso también cuentan
+    para el límite. */
+shared_ptr<const TablaCandidatos> Servidor::tabla(InstanciaServidor& inst, int k) {
+    const uint64_t bytes = bytes_tabla_candidatos(inst.F.size(), k);
+    {
+        lock_guard<mutex> lk(inst.m_tablas);
+        auto it = inst.tablas.find(k);
+        if (it != inst.tablas.end()) return it->second;
+        if (bytes > max_bytes_tablas_ - min(inst.bytes_tablas, max_bytes_tablas_)) {
+            throw invalid_argument("Tabla de la exhaustiva demasiado grande para k=" + to_string(k) + " (" +
+                                   to_string(bytes >> 20) + " MB; límite " + to_string(max_bytes_tablas_ >> 20) +
+                                   " MB, en uso " + to_string(inst.bytes_tablas >> 20) + " MB)");
+        }
+        inst.bytes_tablas += bytes;
+    }
+    shared_ptr<const TablaCandidatos> t;
+    try {
+        t = make_shared<const TablaCandidatos>(construir_tabla_candidatos(inst.F, inst.U, k));
+    } catch (...) {
+        lock_guard<mutex> lk(inst.m_tablas);
+        inst.bytes_tablas -= bytes;
+        throw;
+    }
+    lock_guard<mutex> lk(inst.m_tablas);
+    auto r = inst.tablas.emplace(k, t);
+    if (!r.second) inst.bytes_tablas -= bytes;
+    return r.first->second;
+}
+
+//------------------------------------------------------------------
+// Resolución de una petición SOLVE
+//------------------------------------------------------------------
+string Servidor::resolver(const string& linea) {
+    // Argumentos clave=valor
+    map<string, string> arg;
+    stringstream ss(linea);
+    string tok;
+    ss >> tok; // SOLVE
+    while (ss >> tok) {
+        size_t eq = tok.find('=');
+        if (eq == string::npos) throw invalid_argument("Argumento inválido: " + tok);
+        arg[tok.substr(0, eq)] = tok.substr(eq + 1);
+    }
+    auto valor = [&](const string& c, const string& def) {
+        auto it = arg.find(c);
+        return it == arg.end() ? def : it->second;
+    };
+
+    const string id = valor("id", "");
+    const string algo = valor("algo", "greedy");
+    const int k = stoi(valor("k", "3"));
+    if (k < 0) throw invalid_argument("k debe ser >= 0");
+    const bool con_expr = valor("expr", "1") != "0";
+    auto inst = buscar(valor("inst", "default"));
+
+    // Objetivo G: lista de elementos o generado por semilla
+    Bitset G;
+    if (arg.count("G")) {
+        stringstream sg(arg["G"]);
+        string e;
+        while (getline(sg, e, ',')) {
+            int i = stoi(e);
+            if (i < 0 || i >= inst->universo) throw invalid_argument("Elemento fuera del universo: " + e);
+            G[i] = 1;
+        }
+    } else if (arg.count("G_seed")) {
+        G = generar_G(inst->universo, stoi(valor("G_size", "10")), stoi(arg["G_seed"]));
+    } else {
+        throw invalid_argument("Falta el objetivo (G=... o G_seed=...)");
+    }
+
+    auto t0 = chrono::steady_clock::now();
+    vector<SolMO> frente;
+    if (algo == "exhaustiva") {
+        frente = evaluar_objetivos(*tabla(*inst, k), {G})[0];
+    } else if (algo == "greedy") {
+        vector<SolMO> bloques = inst->bloques_greedy;
+        puntuar_bloques_base(bloques, G);
+        frente = greedy_multiobjective_search(inst->F, inst->U, G, k, nullptr, nullptr, &bloques);
+    } else if (algo == "genetico") {
+        GAParams p;
+        p.population_size = stoi(valor("pop_size", "150"));
+        p.max_generations = stoi(valor("max_generations", "100"));
+        p.time_limit_sec = stoi(valor("time_limit", "10"));
+        p.mutation_prob = 0.5;
+        p.tournament_size = 5;
+        p.seed = stoull(valor("seed_expr", "1"));
+        vector<SolMO> bloques = inst->bloques_ga;
+        puntuar_bloques_base(bloques, G);
+        for (const auto& ind : nsga2_desde(inst->F, inst->U, G, k, p, {}, nullptr, nullptr, &bloques)) {
+            frente.push_back(ind);
+        }
+    } else {
+        throw invalid_argument("Algoritmo desconocido: " + algo);
+    }
+    auto dur_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+
+    string r = "{\"id\":";
+    anadir_json_texto(r, id);
+    r += ",\"estado\":\"ok\",\"algo\":";
+    anadir_json_texto(r, algo);
+    r += ",\"tiempo_ms\":" + to_string(dur_ms);
+    char num[32];
+    snprintf(num, sizeof(num), "%.17g", cota_jaccard(inst->atomos, G));
+    r += ",\"cota_jaccard\":";
+    r += num;
+    r += ",\"frente\":[";
+    for (size_t i = 0; i < frente.size(); i++) {
+        if (i) r += ',';
+        anadir_solucion_json(r, frente[i], con_expr);
+    }
+    r += "]}";
+    return r;
+}
+
+//------------------------------------------------------------------
+// Despacho de una línea
+//------------------------------------------------------------------
+bool Servidor::atender(const string& linea, const shared_ptr<Conexion>& con) {
+    stringstream ss(linea);
+    string cmd;
+    if (!(ss >> cmd)) return true;
+
+    if (cmd == "SOLVE") {
+        pool_.enviar([this, linea, con] {
+            string id;
+            size_t p = linea.find(" id=");
+            if (p != string::npos) id = linea.substr(p + 4, linea.find(' ', p + 4) - (p + 4));
+            try {
+                con->escribir(resolver(linea));
+            } catch (const exception& e) {
+                con->escribir(respuesta_error(id, e.what()));
+            }
+        });
+    } else if (cmd == "LOAD") {
+        string nombre, path;
+        ss >> nombre >> path;
+        try {
+            uint64_t universo = 0;
+            auto cargada = cargar_instancia(path, &universo);
+            registrar_instancia(nombre, move(cargada.F), universo_hasta(universo));
+            con->escribir("{\"estado\":\"ok\",\"cargada\":\"" + nombre + "\"}");
+        } catch (const exception& e) {
+            con->escribir(respuesta_error("", e.what()));
+        }
+    } else if (cmd == "LIST") {
+        string r = "{\"estado\":\"ok\",\"instancias\":[";
+        lock_guard<mutex> lk(m_instancias_);
+        bool primero = true;
+        for (const auto& [nombre, inst] : instancias_) {
+            if (!primero) r += ',';
+            r += "{\"nombre\":";
+            anadir_json_texto(r, nombre);
+            r += ",\"num_F\":" + to_string(inst->F.size()) +
+                 ",\"num_atomos\":" + to_string(inst->atomos.tam.size()) + "}";
+            primero = false;
+        }
+        con->escribir(r + "]}");
+    } else if (cmd == "QUIT") {
+        return false;
+    } else if (cmd == "SHUTDOWN") {
+        parar_ = true;
+#if !defined(_WIN32)
+        if (fd_escucha_ >= 0) ::shutdown(fd_escucha_, SHUT_RDWR);
+#endif
+        return false;
+    } else {
+        con->escribir(respuesta_error("", "Comando desconocido: " + cmd));
+    }
+    return true;
+}
+
+//------------------------------------------------------------------
+// Bucles de servicio
+//------------------------------------------------------------------
+void Servidor::servir_stdin() {
+    auto con = make_shared<Conexion>();
+    string linea;
+    while (getline(cin, linea)) {
+        if (!atender(linea, con)) break;
+    }
+    pool_.esperar();
+}
+
+void Servidor::servir_socket(const string& path) {
+#if defined(_WIN32)
+    (void)path;
+    throw runtime_error("Socket Unix no disponible en esta plataforma");
+#else
+    fd_escucha_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd_escucha_ < 0) throw runtime_error("No se pudo crear el socket");
+    sockaddr_un dir{};
+    dir.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(dir.sun_path)) throw invalid_argument("Ruta de socket demasiado larga: " + path);
+    snprintf(dir.sun_path, sizeof(dir.sun_path), "%s", path.c_str());
+    ::unlink(path.c_str());
+    if (::bind(fd_escucha_, (sockaddr*)&dir, sizeof(dir)) != 0 || ::listen(fd_escucha_, 16) != 0) {
+        ::close(fd_escucha_);
+        throw runtime_error("No se pudo escuchar en " + path);
+    }
+
+    /* Un hilo lector separado por cliente; las peticiones van al pool
+        compartido. 'abiertos' son los clientes vivos: cada lector se
+        quita al terminar y la parada espera a que no quede ninguno. */
+    mutex m_clientes;
+    condition_variable cv_clientes;
+    vector<int> abiertos;
+    while (!parar_) {
+        int fd = ::accept(fd_escucha_, nullptr, nullptr);
+        if (fd < 0) break;
+        {
+            lock_guard<mutex> lk(m_clientes);
+            abiertos.push_back(fd);
+        }
+        thread([this, fd, &m_clientes, &cv_clientes, &abiertos] {
+            auto con = make_shared<Conexion>();
+            con->fd = fd;
+            string pendiente, linea;
+            char buf[4096];
+            bool seguir = true;
+            while (seguir) {
+                ssize_t n = ::read(fd, buf, sizeof(buf));
+                if (n <= 0) break;
+                pendiente.append(buf, (size_t)n);
+                size_t p;
+                while (seguir && (p = pendiente.find('\n')) != string::npos) {
+                    linea = pendiente.substr(0, p);
+                    pendiente.erase(0, p + 1);
+                    seguir = atender(linea, con);
+                }
+            }
+            lock_guard<mutex> lk(m_clientes);
+            abiertos.erase(find(abiertos.begin(), abiertos.end(), fd));
+            cv_clientes.notify_all();
+        }).detach();
+    }
+
+    // Parada: desbloquear lectores, terminar peticiones en curso y cerrar
+    {
+        unique_lock<mutex> lk(m_clientes);
+        for (int fd : abiertos) ::shutdown(fd, SHUT_RD);
+        cv_clientes.wait(lk, [&] { return abiertos.empty(); });
+    }
+    pool_.esperar();
+    ::close(fd_escucha_);
+    fd_escucha_ = -1;
+    ::unlink(path.c_str());
+#endif
+}
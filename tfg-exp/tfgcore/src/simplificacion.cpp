@@ -0,0 +1,119 @@
+//----------------------------------------------------------------------
+// simplificacion.cpp
+//----------------------------------------------------------------------
+// Simplificación y forma canónica de expresiones.
+//----------------------------------------------------------------------
+
+#include "simplificacion.hpp"
+
+#include <set>
+#include <stdexcept>
+
+#include "arbol.hpp"
+
+using namespace std;
+
+namespace {
+
+// Subexpresión ya simplificada
+struct Sub {
+    string texto;
+    Bitset conjunto;
+    set<int> usados;    // U = -1
+    int n_ops = 0;
+};
+
+// ¿Es 'a' más simple que 'b'? (menos operaciones y después menos conjuntos)
+bool mas_simple(const Sub& a, const Sub& b) {
+    if (a.n_ops != b.n_ops) return a.n_ops < b.n_ops;
+    return a.usados.size() < b.usados.size();
+}
+
+Sub hoja(const string& texto, const Bitset& conjunto, int indice) {
+    Sub s;
+    s.texto = texto;
+    s.conjunto = conjunto;
+    if (indice != HOJA_VACIA) s.usados.insert(indice);
+    return s;
+}
+
+struct Simplificador {
+    const ArbolExpr& t;
+    const vector<Bitset>& F;
+    const Bitset& U;
+
+    Sub nodo(int v) const {
+        const NodoExpr& n = t.nodos[v];
+        if (n.op < 0) {
+            if (n.hoja == HOJA_U) return hoja("U", U, HOJA_U);
+            if (n.hoja == HOJA_VACIA) return hoja("∅", Bitset(), HOJA_VACIA);
+            return hoja("F" + to_string(n.hoja), F[n.hoja], n.hoja);
+        }
+
+        Sub a = nodo(n.izq), b = nodo(n.der);
+        const Bitset r = apply_op(n.op, a.conjunto, b.conjunto);
+        set<int> usados = a.usados;
+        usados.insert(b.usados.begin(), b.usados.end());
+
+        // Candidatos equivalentes (mismo conjunto) que no añaden conjuntos nuevos
+        const Sub* mejor = nullptr;
+        Sub alternativa;
+        auto considerar = [&](const Sub& c) {
+            if (c.conjunto != r) return;
+            if (!mejor || mas_simple(c, *mejor)) mejor = &c;
+        };
+        considerar(a);
+        considerar(b);
+        Sub vacio = hoja("∅", Bitset(), HOJA_VACIA);
+        considerar(vacio);
+        Sub universo = hoja("U", U, HOJA_U);
+        if (usados.count(HOJA_U)) considerar(universo);
+        if (!mejor || mejor->n_ops > 0) {
+            for (int i : usados) {
+                if (i >= 0 && F[i] == r) {
+                    alternativa = hoja("F" + to_string(i), F[i], i);
+                    considerar(alternativa);
+                    break;
+                }
+            }
+        }
+        if (mejor) return *mejor;
+
+        // Nodo sin simplificar; ∪ y ∩ con operandos ordenados
+        if (n.op != 2 && b.texto < a.texto) swap(a, b);
+        Sub s;
+        s.texto = "(" + a.texto + texto_op(n.op) + b.texto + ")";
+        s.conjunto = r;
+        s.usados = move(usados);
+        s.n_ops = a.n_ops + b.n_ops + 1;
+        return s;
+    }
+};
+
+} // namespace
+
+//------------------------------------------------------------------
+// Interfaz
+//------------------------------------------------------------------
+bool simplificar_expresion(Expression& e, const vector<Bitset>& F, const Bitset& U) {
+    ArbolExpr t;
+    try {
+        t = parsear_expresion(e.expr_str, F, U);
+    } catch (const invalid_argument&) {
+        return false;
+    }
+    Sub s = Simplificador{t, F, U}.nodo(t.raiz);
+    if (s.texto == e.expr_str) return false;
+
+    // Mantener el criterio de la expresión de entrada sobre U
+    if (!e.used_sets.count(HOJA_U)) s.usados.erase(HOJA_U);
+    e.expr_str = move(s.texto);
+    e.used_sets = move(s.usados);
+    e.n_ops = s.n_ops;
+    return true;
+}
+
+string forma_canonica(const string& expr_str, const vector<Bitset>& F, const Bitset& U) {
+    ArbolExpr t = parsear_expresion(expr_str, F, U);
+    return Simplificador{t, F, U}.nodo(t.raiz).texto;
+}
@@ -0,0 +1,198 @@
+//----------------------------------------------------------------------
+// tfgcore_c.cpp
+//----------------------------------------------------------------------
+// Implementación de la API C (tfgcore_c.h) sobre el núcleo C++.
+//----------------------------------------------------------------------
+
+#include "tfgcore_c.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "batch.hpp"
+#include "exhaustiva.hpp"
+#include "genetico.hpp"
+#include "greedy.hpp"
+#include "instance_io.hpp"
+#include "solutions.hpp"
+
+using namespace std;
+
+struct tfg_instancia {
+    uint64_t universo = 0;
+    vector<Bitset> F;
+    Bitset U;
+
+    // Tablas de la exhaustiva por k (independientes de G)
+    mutex m_tablas;
+    map<int, shared_ptr<const TablaCandidatos>> tablas;
+};
+
+struct tfg_frente {
+    vector<SolMO> soluciones;
+    long long tiempo_ms = 0;
+};
+
+//------------------------------------------------------------------
+// Errores: las excepciones no cruzan la frontera C
+//------------------------------------------------------------------
+static thread_local string t_ultimo_error;
+
+template<typename Fn>
+static tfg_estado proteger(Fn&& fn) {
+    t_ultimo_error.clear();
+    try {
+        fn();
+        return TFG_OK;
+    } catch (const invalid_argument& e) {
+        t_ultimo_error = e.what();
+        return TFG_ERROR_ARGUMENTO;
+    } catch (const runtime_error& e) {
+        t_ultimo_error = e.what();
+        return TFG_ERROR_FICHERO;
+    } catch (const exception& e) {
+        t_ultimo_error = e.what();
+        return TFG_ERROR_INTERNO;
+    } catch (...) {
+        t_ultimo_error = "Error desconocido";
+        return TFG_ERROR_INTERNO;
+    }
+}
+
+//------------------------------------------------------------------
+// Información y parámetros
+//------------------------------------------------------------------
+int tfg_version(void) { return TFG_API_VERSION; }
+uint64_t tfg_u_size(void) { return (uint64_t)U_size; }
+uint64_t tfg_palabras(uint64_t universo) { return palabras_para(universo); }
+const char* tfg_ultimo_error(void) { return t_ultimo_error.c_str(); }
+
+void tfg_parametros_defecto(tfg_parametros* p) {
+    if (!p) return;
+    GAParams ga;
+    p->algoritmo = TFG_GREEDY;
+    p->k = 3;
+    p->pop_size = ga.population_size;
+    p->max_generations = ga.max_generations;
+    p->time_limit_sec = ga.time_limit_sec;
+    p->crossover_prob = ga.crossover_prob;
+    p->mutation_prob = ga.mutation_prob;
+    p->tournament_size = ga.tournament_size;
+    p->seed = ga.seed;
+}
+
+//------------------------------------------------------------------
+// Instancias
+//------------------------------------------------------------------
+tfg_estado tfg_instancia_crear(uint64_t universo, const uint64_t* F, uint32_t num_F, tfg_instancia** out) {
+    return proteger([&] {
+        if (!out || (!F && num_F > 0)) throw invalid_argument("Puntero nulo");
+        *out = nullptr;
+        auto inst = make_unique<tfg_instancia>();
+        const uint64_t wpc = palabras_para(universo);
+        inst->universo = universo;
+        inst->U = universo_hasta(universo);
+        inst->F.reserve(num_F);
+        for (uint32_t j = 0; j < num_F; j++) inst->F.push_back(palabras_a_bitset(F + j * wpc, universo));
+        *out = inst.release();
+    });
+}
+
+tfg_estado tfg_instancia_cargar(const char* path, tfg_instancia** out) {
+    return proteger([&] {
+        if (!path || !out) throw invalid_argument("Puntero nulo");
+        *out = nullptr;
+        InstanciaMapeada m(path);
+        auto inst = make_unique<tfg_instancia>();
+        inst->universo = m.universo();
+        inst->U = universo_hasta(m.universo());
+        inst->F.reserve(m.num_F());
+        for (uint64_t j = 0; j < m.num_F(); j++) inst->F.push_back(palabras_a_bitset(m.F(j), m.universo()));
+        *out = inst.release();
+    });
+}
+
+uint32_t tfg_instancia_num_conjuntos(const tfg_instancia* inst) {
+    return inst ? (uint32_t)inst->F.size() : 0;
+}
+
+void tfg_instancia_liberar(tfg_instancia* inst) { delete inst; }
+
+//------------------------------------------------------------------
+// Resolución
+//------------------------------------------------------------------
+static shared_ptr<const TablaCandidatos> tabla_para(tfg_instancia& inst, int k) {
+    {
+        lock_guard<mutex> lk(inst.m_tablas);
+        auto it = inst.tablas.find(k);
+        if (it != inst.tablas.end()) return it->second;
+    }
+    auto t = make_shared<const TablaCandidatos>(construir_tabla_candidatos(inst.F, inst.U, k));
+    lock_guard<mutex> lk(inst.m_tablas);
+    return inst.tablas.emplace(k, t).first->second;
+}
+
+tfg_estado tfg_resolver(tfg_instancia* inst, const uint64_t* G, const tfg_parametros* p, tfg_frente** out) {
+    return proteger([&] {
+        if (!inst || !G || !p || !out) throw invalid_argument("Puntero nulo");
+        if (p->k < 0) throw invalid_argument("k debe ser >= 0");
+        *out = nullptr;
+        const Bitset objetivo = palabras_a_bitset(G, inst->universo);
+
+        auto f = make_unique<tfg_frente>();
+        auto t0 = chrono::steady_clock::now();
+        switch (p->algoritmo) {
+        case TFG_GREEDY:
+            f->soluciones = greedy_multiobjective_search(inst->F, inst->U, objetivo, p->k);
+            break;
+        case TFG_EXHAUSTIVA:
+            f->soluciones = evaluar_objetivos(*tabla_para(*inst, p->k), {objetivo})[0];
+            break;
+        case TFG_NSGA2: {
+            GAParams ga;
+            ga.population_size = p->pop_size;
+            ga.max_generations = p->max_generations;
+            ga.time_limit_sec = p->time_limit_sec;
+            ga.crossover_prob = p->crossover_prob;
+            ga.mutation_prob = p->mutation_prob;
+            ga.tournament_size = p->tournament_size;
+            ga.seed = p->seed;
+            auto frente = nsga2(inst->F, inst->U, objetivo, p->k, ga);
+            f->soluciones.assign(frente.begin(), frente.end());
+            break;
+        }
+        default:
+            throw invalid_argument("Algoritmo desconocido: " + to_string(p->algoritmo));
+        }
+        f->tiempo_ms = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - t0).count();
+        *out = f.release();
+    });
+}
+
+//------------------------------------------------------------------
+// Frentes
+//------------------------------------------------------------------
+size_t tfg_frente_tam(const tfg_frente* f) { return f ? f->soluciones.size() : 0; }
+
+tfg_estado tfg_frente_solucion(const tfg_frente* f, size_t i, tfg_solucion* out) {
+    if (!f || !out || i >= f->soluciones.size()) {
+        t_ultimo_error = "Índice fuera del frente";
+        return TFG_ERROR_ARGUMENTO;
+    }
+    const SolMO& s = f->soluciones[i];
+    out->n_ops = s.n_ops;
+    out->sizeH = s.sizeH;
+    out->jaccard = s.jaccard;
+    out->expr = s.expr.expr_str.c_str();
+    out->expr_len = s.expr.expr_str.size();
+    return TFG_OK;
+}
+
+long long tfg_frente_tiempo_ms(const tfg_frente* f) { return f ? f->tiempo_ms : 0; }
+
+void tfg_frente_liberar(tfg_frente* f) { delete f; }